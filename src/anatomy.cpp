@@ -76,6 +76,7 @@ void anatomy::finalize()
     size_sum = 0.0f;
 
     cached_bps.clear();
+    sorted_bps.clear();
     for( const bodypart_str_id &id : unloaded_bps ) {
         if( id.is_valid() ) {
             add_body_part( id );
@@ -133,6 +134,11 @@ std::vector<bodypart_id> anatomy::get_bodyparts() const
     return cached_bps;
 }
 
+const std::vector<bodypart_str_id> &anatomy::get_sorted_bodyparts() const
+{
+    return sorted_bps;
+}
+
 float anatomy::get_size_ratio( const anatomy_id &base ) const
 {
     float ret = get_hit_size_sum() / get_base_hit_size_sum( base );
@@ -183,6 +189,10 @@ anatomy::anatomy( const std::vector<bodypart_id> &parts )
 void anatomy::add_body_part( const bodypart_str_id &new_bp )
 {
     cached_bps.emplace_back( new_bp.id() );
+    const auto sorted_pos = std::lower_bound( sorted_bps.begin(), sorted_bps.end(), new_bp );
+    if( sorted_pos == sorted_bps.end() || *sorted_pos != new_bp ) {
+        sorted_bps.insert( sorted_pos, new_bp );
+    }
     const body_part_type &bp_struct = new_bp.obj();
     size_sum += bp_struct.hit_size;
 }
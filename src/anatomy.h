@@ -22,6 +22,8 @@ class anatomy
     private:
         std::vector<bodypart_str_id> unloaded_bps;
         std::vector<bodypart_id> cached_bps;
+        // The same parts ordered by id, which is how creatures store them
+        std::vector<bodypart_str_id> sorted_bps;
         /** Sum of chances to hit a body part randomly, without aiming. */
         float size_sum = 0.0f;
 
@@ -54,6 +56,8 @@ class anatomy
                 double value ) const;
 
         std::vector<bodypart_id> get_bodyparts() const;
+        /** The body parts ordered by id, for building a bodypart_flat_map. */
+        const std::vector<bodypart_str_id> &get_sorted_bodyparts() const;
         float get_size_ratio( const anatomy_id &base ) const;
         float get_hit_size_sum() const;
         float get_organic_size_sum() const;
@@ -24,6 +24,7 @@
 #include "ballistics.h"
 #include "bodypart.h"
 #include "calendar.h"
+#include "cata_scope_helpers.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "character_attire.h"
@@ -713,6 +714,7 @@ void npc::check_or_use_weapon_cbm( const bionic_id &cbm_id )
             set_wielded_item( cbm_weapon );
             mod_power_level( -bio.info().power_activate );
             bio.powered = true;
+            invalidate_flag_index();
             weapon_bionic_uid = bio.get_uid();
         }
     }
@@ -725,6 +727,10 @@ void npc::check_or_use_weapon_cbm( const bionic_id &cbm_id )
 // share functions....
 bool Character::activate_bionic( bionic &bio, bool eff_only, bool *close_bionics_ui )
 {
+    // Any of the paths below may switch bionics on or off
+    on_out_of_scope invalidate_bionic_flags( [this]() {
+        flag_index.invalidate( character_flag_index::source::bionic );
+    } );
     const bool mounted = is_mounted();
     if( bio.incapacitated_time > 0_turns ) {
         add_msg( m_info, _( "Your %s is shorting out and can't be activated." ),
@@ -1171,7 +1177,6 @@ bool Character::activate_bionic( bionic &bio, bool eff_only, bool *close_bionics
             }
         }
     }
-    bio_flag_cache.clear();
     calc_encumbrance();
 
     // Also reset crafting inventory cache if this bionic spawned a fake item
@@ -1217,7 +1222,7 @@ bool Character::deactivate_bionic( bionic &bio, bool eff_only )
     const map &here = get_map();
 
     const auto can_deactivate = can_deactivate_bionic( bio, eff_only );
-    bio_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::bionic );
     if( !can_deactivate.success() ) {
         if( !can_deactivate.str().empty() ) {
             add_msg( m_info,  can_deactivate.str() );
@@ -2791,7 +2796,7 @@ bionic_uid Character::add_bionic( const bionic_id &b, bionic_uid parent_uid,
             wear_item( tmparmor, false );
         }
     }
-    bio_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::bionic );
     invalidate_pseudo_items();
     update_bionic_power_capacity();
 
@@ -2877,7 +2882,7 @@ void Character::remove_bionic( const bionic &bio )
 
     const bool has_enchantments = !bio.id->enchantments.empty();
     *my_bionics = new_my_bionics;
-    bio_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::bionic );
     update_last_bionic_uid();
     invalidate_pseudo_items();
     update_bionic_power_capacity();
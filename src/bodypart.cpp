@@ -1252,3 +1252,88 @@ void stat_hp_mods::deserialize( const JsonObject &jo )
 {
     load( jo );
 }
+
+bodypart_flat_map &bodypart_flat_map::operator=( const bodypart_flat_map &rhs )
+{
+    if( this != &rhs ) {
+        std::vector<value_type> copy( rhs.parts );
+        parts.swap( copy );
+    }
+    return *this;
+}
+
+void bodypart_flat_map::assign( const std::vector<bodypart_str_id> &ids )
+{
+    std::vector<value_type> fresh;
+    fresh.reserve( ids.size() );
+    for( const bodypart_str_id &id : ids ) {
+        fresh.emplace_back( id, bodypart( id ) );
+    }
+    parts.swap( fresh );
+}
+
+static bool part_id_less( const bodypart_flat_map::value_type &part, const bodypart_str_id &id )
+{
+    return part.first < id;
+}
+
+bodypart_flat_map::iterator bodypart_flat_map::find( const bodypart_str_id &id )
+{
+    const iterator it = std::lower_bound( parts.begin(), parts.end(), id, part_id_less );
+    return it != parts.end() && it->first == id ? it : parts.end();
+}
+
+bodypart_flat_map::const_iterator bodypart_flat_map::find( const bodypart_str_id &id ) const
+{
+    const const_iterator it = std::lower_bound( parts.begin(), parts.end(), id, part_id_less );
+    return it != parts.end() && it->first == id ? it : parts.end();
+}
+
+size_t bodypart_flat_map::count( const bodypart_str_id &id ) const
+{
+    return find( id ) != end() ? 1 : 0;
+}
+
+std::pair<bodypart_flat_map::iterator, bool> bodypart_flat_map::emplace( const bodypart_str_id &id,
+        bodypart &&part )
+{
+    const size_t pos = std::lower_bound( parts.begin(), parts.end(), id, part_id_less ) -
+                       parts.begin();
+    if( pos < parts.size() && parts[pos].first == id ) {
+        return { parts.begin() + pos, false };
+    }
+    std::vector<value_type> grown;
+    grown.reserve( parts.size() + 1 );
+    for( size_t i = 0; i < pos; i++ ) {
+        grown.emplace_back( std::move( parts[i] ) );
+    }
+    grown.emplace_back( id, std::move( part ) );
+    for( size_t i = pos; i < parts.size(); i++ ) {
+        grown.emplace_back( std::move( parts[i] ) );
+    }
+    parts.swap( grown );
+    return { parts.begin() + pos, true };
+}
+
+bodypart &bodypart_flat_map::operator[]( const bodypart_str_id &id )
+{
+    const iterator it = find( id );
+    if( it != end() ) {
+        return it->second;
+    }
+    return emplace( id, bodypart( id ) ).first->second;
+}
+
+bodypart_flat_map::iterator bodypart_flat_map::erase( const_iterator pos )
+{
+    const size_t index = pos - parts.cbegin();
+    std::vector<value_type> shrunk;
+    shrunk.reserve( parts.size() - 1 );
+    for( size_t i = 0; i < parts.size(); i++ ) {
+        if( i != index ) {
+            shrunk.emplace_back( std::move( parts[i] ) );
+        }
+    }
+    parts.swap( shrunk );
+    return parts.begin() + index;
+}
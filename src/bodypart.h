@@ -544,6 +544,67 @@ class bodypart
         void deserialize( const JsonObject &jo );
 };
 
+/**
+ * The body parts of a creature, stored contiguously and ordered by id.
+ *
+ * Offers the parts of the std::map interface creatures use. Looking up a part is a binary
+ * search over a handful of adjacent elements instead of a walk through separately allocated
+ * tree nodes. Adding or removing parts rebuilds the storage, which invalidates iterators and
+ * references to all parts; that only happens when the anatomy of the creature changes.
+ */
+class bodypart_flat_map
+{
+    public:
+        using key_type = bodypart_str_id;
+        using mapped_type = bodypart;
+        using value_type = std::pair<const bodypart_str_id, bodypart>;
+        using iterator = std::vector<value_type>::iterator;
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        bodypart_flat_map() = default;
+        bodypart_flat_map( const bodypart_flat_map & ) = default;
+        bodypart_flat_map( bodypart_flat_map && ) noexcept = default;
+        // The keys are const, so assigning has to replace the whole storage
+        bodypart_flat_map &operator=( const bodypart_flat_map &rhs );
+        bodypart_flat_map &operator=( bodypart_flat_map && ) noexcept = default;
+
+        iterator begin() {
+            return parts.begin();
+        }
+        iterator end() {
+            return parts.end();
+        }
+        const_iterator begin() const {
+            return parts.begin();
+        }
+        const_iterator end() const {
+            return parts.end();
+        }
+        size_t size() const {
+            return parts.size();
+        }
+        bool empty() const {
+            return parts.empty();
+        }
+        void clear() {
+            parts.clear();
+        }
+
+        /** Replaces the contents with fresh parts for @p ids, which must be sorted and unique. */
+        void assign( const std::vector<bodypart_str_id> &ids );
+
+        iterator find( const bodypart_str_id &id );
+        const_iterator find( const bodypart_str_id &id ) const;
+        size_t count( const bodypart_str_id &id ) const;
+        /** Adds @p part as @p id unless there already is a part with that id. */
+        std::pair<iterator, bool> emplace( const bodypart_str_id &id, bodypart &&part );
+        bodypart &operator[]( const bodypart_str_id &id );
+        iterator erase( const_iterator pos );
+
+    private:
+        std::vector<value_type> parts;
+};
+
 /** Returns the new id for old token */
 const bodypart_str_id &convert_bp( body_part bp );
 
@@ -232,7 +232,7 @@ cata_tiles::cata_tiles( const SDL_Renderer_Ptr &renderer, const GeometryRenderer
     renderer( renderer ),
     geometry( geometry ),
     cache( cache ),
-    minimap( renderer, geometry )
+    minimap( renderer )
 {
     cata_assert( renderer );
 
@@ -115,6 +115,29 @@ bool lcmatch( std::string_view str, std::string_view qry )
     return false;
 }
 
+lc_search_key::lc_search_key( std::string_view str ) : lowercase( utf8_to_utf32( str ) )
+{
+    std::for_each( lowercase.begin(), lowercase.end(), u32_to_lowercase );
+    unaccented = lowercase;
+    std::for_each( unaccented.begin(), unaccented.end(), remove_accent );
+}
+
+std::u32string lc_search_query( std::string_view qry )
+{
+    std::u32string u32_qry = utf8_to_utf32( qry );
+    std::for_each( u32_qry.begin(), u32_qry.end(), u32_to_lowercase );
+    return u32_qry;
+}
+
+bool lcmatch( const lc_search_key &key, const std::u32string &qry )
+{
+    if( qry.empty() || key.lowercase.find( qry ) != std::u32string::npos ||
+        key.unaccented.find( qry ) != std::u32string::npos ) {
+        return true;
+    }
+    return use_pinyin_search && pinyin::pinyin_match( key.unaccented, qry );
+}
+
 bool lcmatch( const translation &str, std::string_view qry )
 {
     return lcmatch( str.translated(), qry );
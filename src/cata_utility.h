@@ -114,6 +114,22 @@ bool isBetween( int test, int down, int up );
 bool lcmatch( std::string_view str, std::string_view qry );
 bool lcmatch( const translation &str, std::string_view qry );
 
+/**
+ * The lowercase forms of a subject string used by @ref lcmatch, converted once so the subject
+ * can be searched for many queries.
+ */
+struct lc_search_key {
+    lc_search_key() = default;
+    explicit lc_search_key( std::string_view str );
+
+    std::u32string lowercase;
+    std::u32string unaccented;
+};
+/** Converts a query string for matching against @ref lc_search_key. */
+std::u32string lc_search_query( std::string_view qry );
+/** Same as lcmatch( str, qry ) for a key made from str and a query from @ref lc_search_query. */
+bool lcmatch( const lc_search_key &key, const std::u32string &qry );
+
 /**
  * Matches text case insensitive with the include/exclude rules of the filter
  *
@@ -633,8 +633,7 @@ Character::Character() :
     // Only call these if game is initialized
     if( !!g && json_flag::is_ready() ) {
         recalc_sight_limits();
-        trait_flag_cache.clear();
-        bio_flag_cache.clear();
+        invalidate_flag_index();
         calc_encumbrance();
         worn.recalc_ablative_blocking(this);
     }
@@ -2637,6 +2636,9 @@ void Character::calc_all_parts_hp( float hp_mod, float hp_adjustment, int str_ma
 // 'wears' vector is still allowed due to refactor exhaustion.
 void Character::recalc_sight_limits()
 {
+    // Called whenever clothing, effects or mutations may have changed how the character sees
+    // or is seen
+    get_creature_tracker().invalidate_visibility_cache();
     sight_max = 9999;
     vision_mode_cache.reset();
     const bool in_light = get_map().ambient_light_at( pos_bub() ) > LIGHT_AMBIENT_LIT;
@@ -7729,6 +7731,7 @@ void Character::recalculate_bodyparts()
             body[bp] = bodypart( bp );
         }
     }
+    on_body_changed();
     tally_organic_size();
     recalc_limb_energy_usage();
 
@@ -7741,42 +7744,33 @@ void Character::recalculate_bodyparts()
                    get_cached_organic_size() );
 }
 
-void Character::recalculate_enchantment_cache()
+template<typename Fn, typename Between>
+void Character::visit_enchantments( Fn &&fn, Between &&before_mutations )
 {
-    enchantment_cache->clear();
-
-    cache_visit_items_with( "is_relic", &item::is_relic, [this]( const item & it ) {
+    cache_visit_items_with( "is_relic", &item::is_relic, [this, &fn]( const item & it ) {
         for( const enchant_cache &ench : it.get_proc_enchantments() ) {
-            if( ench.is_active( *this, it ) ) {
-                enchantment_cache->force_add( ench );
-            }
+            fn( ench, &it, ench.is_active( *this, it ), enchantment_origin::item_proc );
         }
         for( const enchantment &ench : it.get_defined_enchantments() ) {
-            if( ench.is_active( *this, it ) ) {
-                enchantment_cache->force_add( ench, *this );
-            }
+            fn( ench, &it, ench.is_active( *this, it ), enchantment_origin::item );
         }
     } );
 
-
     for( const bionic &bio : *my_bionics ) {
         const bionic_id &bid = bio.id;
 
         for( const enchantment_id &ench_id : bid->enchantments ) {
             const enchantment &ench = ench_id.obj();
-            if( ench.is_active( *this, bio.powered &&
-                                bid->has_flag( STATIC( json_character_flag( "BIONIC_TOGGLED" ) ) ) ) ) {
-                enchantment_cache->force_add( ench, *this );
-            }
+            fn( ench, nullptr, ench.is_active( *this, bio.powered &&
+                                               bid->has_flag( STATIC( json_character_flag( "BIONIC_TOGGLED" ) ) ) ),
+                enchantment_origin::bionic );
         }
     }
 
     for( const auto &elem : *effects ) {
         for( const enchantment_id &ench_id : elem.first->enchantments ) {
             const enchantment &ench = ench_id.obj();
-            if( ench.is_active( *this, true ) ) {
-                enchantment_cache->force_add( ench, *this );
-            }
+            fn( ench, nullptr, ench.is_active( *this, true ), enchantment_origin::effect );
         }
     }
 
@@ -7785,25 +7779,55 @@ void Character::recalculate_enchantment_cache()
             const mutation_branch &mut = mut_map.first.obj();
             for( const enchantment_id &ench_id : mut.enchantments ) {
                 const enchantment &ench = ench_id.obj();
-                if( ench.is_active( *this, mut.activated && mut_map.second.powered ) ) {
-                    enchantment_cache->force_add_mutation( ench );
-                }
+                fn( ench, nullptr, ench.is_active( *this, mut.activated && mut_map.second.powered ),
+                    enchantment_origin::mutation_grant );
             }
         }
     }
-    new_mutation_cache->mutations = enchantment_cache->mutations;
-    update_cached_mutations();
+    before_mutations();
     for( const std::pair<const trait_id, trait_data> &mut_map : cached_mutations ) {
         if( mut_map.second.corrupted == 0 ) {
             const mutation_branch &mut = mut_map.first.obj();
             for( const enchantment_id &ench_id : mut.enchantments ) {
                 const enchantment &ench = ench_id.obj();
-                if( ench.is_active( *this, mut.activated && mut_map.second.powered ) ) {
-                    enchantment_cache->force_add( ench, *this );
-                }
+                fn( ench, nullptr, ench.is_active( *this, mut.activated && mut_map.second.powered ),
+                    enchantment_origin::mutation );
             }
         }
     }
+}
+
+void Character::recalculate_enchantment_cache()
+{
+    enchantment_cache->clear();
+    enchantment_sources.clear();
+    enchantment_values_variable = false;
+
+    visit_enchantments( [this]( const enchantment & ench, const item * source, bool active,
+    enchantment_origin origin ) {
+        enchantment_sources.push_back( { &ench, source, active } );
+        if( !active ) {
+            return;
+        }
+        switch( origin ) {
+            case enchantment_origin::item_proc:
+                enchantment_cache->force_add( static_cast<const enchant_cache &>( ench ) );
+                break;
+            case enchantment_origin::mutation_grant:
+                enchantment_cache->force_add_mutation( ench );
+                break;
+            case enchantment_origin::item:
+            case enchantment_origin::bionic:
+            case enchantment_origin::effect:
+            case enchantment_origin::mutation:
+                enchantment_cache->force_add( ench, *this );
+                enchantment_values_variable |= ench.has_variable_values();
+                break;
+        }
+    }, [this]() {
+        new_mutation_cache->mutations = enchantment_cache->mutations;
+        update_cached_mutations();
+    } );
 
     if( enchantment_cache->modifies_bodyparts() ) {
         recalculate_bodyparts();
@@ -7816,6 +7840,31 @@ void Character::recalculate_enchantment_cache()
     recalc_hp();
 }
 
+void Character::update_enchantment_cache()
+{
+    // Values computed from the character or the world may differ every turn, and mutations
+    // changed without recalculating are only picked up by a recalculation
+    bool changed = enchantment_values_variable || !my_mutations_dirty.empty();
+    if( !changed ) {
+        size_t next = 0;
+        visit_enchantments( [this, &next, &changed]( const enchantment & ench, const item * source,
+        bool active, enchantment_origin ) {
+            changed = changed || next >= enchantment_sources.size() ||
+                      !( enchantment_sources[next] == enchantment_source{ &ench, source, active } );
+            next++;
+        }, []() {} );
+        changed = changed || next != enchantment_sources.size();
+    }
+    if( changed ) {
+        recalculate_enchantment_cache();
+        return;
+    }
+    if( get_stamina() > get_stamina_max() ) {
+        set_stamina( get_stamina_max() );
+    }
+    recalc_hp();
+}
+
 void Character::update_cached_mutations()
 {
     const std::vector<trait_id> &new_muts = new_mutation_cache->get_mutations();
@@ -7923,7 +7972,7 @@ void Character::update_cached_mutations()
     }
     mutations_to_add.clear();
     mutations_to_remove.clear();
-    trait_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::trait );
 }
 
 void Character::passive_absorb_hit( const bodypart_id &bp, damage_unit &du ) const
@@ -10093,6 +10142,8 @@ void Character::on_item_acquire( const item &it )
 void Character::on_effect_int_change( const efftype_id &eid, int intensity,
                                       const bodypart_id &bp )
 {
+    Creature::on_effect_int_change( eid, intensity, bp );
+
     // Adrenaline can reduce perceived pain (or increase it when you enter comedown).
     // See @ref get_perceived_pain()
     if( eid == effect_adrenaline ) {
@@ -10101,6 +10152,17 @@ void Character::on_effect_int_change( const efftype_id &eid, int intensity,
     }
 
     morale->on_effect_int_change( eid, intensity, bp );
+
+    // Flags come with the effect type, so only gaining or losing an effect changes them
+    if( intensity == 0 || !flag_index.has_effect_type( eid ) ) {
+        flag_index.invalidate( character_flag_index::source::effect );
+        flag_index.invalidate( character_flag_index::source::mabuff );
+    }
+}
+
+void Character::on_body_changed()
+{
+    flag_index.invalidate( character_flag_index::source::bodypart );
 }
 
 void Character::on_mutation_gain( const trait_id &mid )
@@ -11520,7 +11582,7 @@ bool Character::sees( const map &here, const tripoint_bub_ms &t, bool, int ) con
     return can_see;
 }
 
-bool Character::sees( const map &here, const Creature &critter ) const
+bool Character::sees_uncached( const map &here, const Creature &critter ) const
 {
     // This handles only the player/npc specific stuff (monsters don't have traits or bionics).
     const int dist = rl_dist( pos_abs(), critter.pos_abs() );
@@ -11535,7 +11597,7 @@ bool Character::sees( const map &here, const Creature &critter ) const
         here.get_field( critter.pos_bub( here ), field_fd_clairvoyant ) ) {
         return true;
     }
-    return Creature::sees( here, critter );
+    return Creature::sees_uncached( here, critter );
 }
 
 void Character::set_destination( const std::vector<tripoint_bub_ms> &route,
@@ -11986,43 +12048,12 @@ int Character::book_fun_for( const item &book, const Character &p ) const
 
 bool Character::has_bionic_with_flag( const json_character_flag &flag ) const
 {
-    auto iter = bio_flag_cache.find( flag );
-    if( iter != bio_flag_cache.end() ) {
-        return iter->second;
-    }
-    for( const bionic &bio : *my_bionics ) {
-        if( bio.info().has_flag( flag ) ) {
-            bio_flag_cache[flag] = true;
-            return true;
-        }
-        if( bio.info().activated ) {
-            if( ( bio.info().has_active_flag( flag ) && has_active_bionic( bio.id ) ) ||
-                ( bio.info().has_inactive_flag( flag ) && !has_active_bionic( bio.id ) ) ) {
-                bio_flag_cache[flag] = true;
-                return true;
-            }
-        }
-    }
-    bio_flag_cache[flag] = false;
-    return false;
+    return indexed_flag_count( character_flag_index::source::bionic, flag ) > 0;
 }
 
 int Character::count_bionic_with_flag( const json_character_flag &flag ) const
 {
-    int ret = 0;
-    for( const bionic &bio : *my_bionics ) {
-        if( bio.info().has_flag( flag ) ) {
-            ret++;
-        }
-        if( bio.info().activated ) {
-            if( ( bio.info().has_active_flag( flag ) && has_active_bionic( bio.id ) ) ||
-                ( bio.info().has_inactive_flag( flag ) && !has_active_bionic( bio.id ) ) ) {
-                ret++;
-            }
-        }
-    }
-
-    return ret;
+    return indexed_flag_count( character_flag_index::source::bionic, flag );
 }
 
 bool Character::has_bodypart_with_flag( const json_character_flag &flag ) const
@@ -12077,26 +12108,159 @@ int Character::count_bodypart_with_flag( const json_character_flag &flag ) const
     return ret;
 }
 
-bool Character::has_flag( const json_character_flag &flag ) const
+void Character::invalidate_flag_index()
 {
-    // If this is a performance problem create a map of flags stored for a character and updated on trait, mutation, bionic add/remove, activate/deactivate, effect gain/loss
-    return has_trait_flag( flag ) ||
-           has_bionic_with_flag( flag ) ||
-           has_effect_with_flag( flag ) ||
-           has_bodypart_with_flag( flag ) ||
-           has_mabuff_flag( flag );
+    flag_index.invalidate_all();
 }
 
-int Character::count_flag( const json_character_flag &flag ) const
+void Character::update_flag_index( character_flag_index::source src ) const
+{
+    using source = character_flag_index::source;
+    flag_index.reset( src );
+    switch( src ) {
+        case source::trait:
+            for( const trait_id &mut : get_functioning_mutations() ) {
+                const mutation_branch &mut_data = mut.obj();
+                for( const json_character_flag &flag : mut_data.flags ) {
+                    flag_index.add( src, flag );
+                }
+                if( !mut_data.activated ) {
+                    continue;
+                }
+                const std::set<json_character_flag> &state_flags = has_active_mutation( mut ) ?
+                        mut_data.active_flags : mut_data.inactive_flags;
+                for( const json_character_flag &flag : state_flags ) {
+                    // A trait counts once even if it has a flag both ways
+                    if( mut_data.flags.count( flag ) == 0 ) {
+                        flag_index.add( src, flag );
+                    }
+                }
+            }
+            break;
+        case source::bionic:
+            for( const bionic &bio : *my_bionics ) {
+                const bionic_data &bio_data = bio.info();
+                for( const json_character_flag &flag : bio_data.flags ) {
+                    flag_index.add( src, flag );
+                }
+                if( bio_data.activated ) {
+                    for( const json_character_flag &flag : has_active_bionic( bio.id ) ?
+                         bio_data.active_flags : bio_data.inactive_flags ) {
+                        flag_index.add( src, flag );
+                    }
+                }
+            }
+            break;
+        case source::effect:
+            for( const auto &elem : *effects ) {
+                flag_index.add_effect_type( elem.first );
+                for( const flag_id &flag : elem.first->get_flags() ) {
+                    flag_index.add( src, flag );
+                }
+            }
+            break;
+        case source::mabuff:
+            for( const auto &elem : *effects ) {
+                for( const auto &eff : elem.second ) {
+                    if( const ma_buff *buff = ma_buff::from_effect( eff.second ) ) {
+                        for( const json_character_flag &flag : buff->flags ) {
+                            flag_index.add( src, flag );
+                        }
+                    }
+                }
+            }
+            break;
+        case source::bodypart:
+            for( const std::pair<const bodypart_str_id, bodypart> &elem : get_body() ) {
+                for( const json_character_flag &flag : elem.first->flags ) {
+                    flag_index.add( src, flag );
+                }
+                for( const json_character_flag &flag : elem.first->conditional_flags ) {
+                    flag_index.add_conditional( flag );
+                }
+            }
+            break;
+        case source::last:
+            break;
+    }
+}
+
+int Character::indexed_flag_count( character_flag_index::source src,
+                                   const json_character_flag &flag ) const
+{
+    if( !flag_index.valid( src ) ) {
+        update_flag_index( src );
+    }
+    return flag_index.count( src, flag );
+}
+
+int Character::count_flag_uncached( const json_character_flag &flag ) const
 {
-    // If this is a performance problem create a map of flags stored for a character and updated on trait, mutation, bionic add/remove, activate/deactivate, effect gain/loss
-    return count_trait_flag( flag ) +
-           count_bionic_with_flag( flag ) +
+    int ret = 0;
+    for( const trait_id &mut : get_functioning_mutations() ) {
+        const mutation_branch &mut_data = mut.obj();
+        if( mut_data.flags.count( flag ) > 0 ) {
+            ret++;
+        } else if( mut_data.activated ) {
+            if( ( mut_data.active_flags.count( flag ) > 0 && has_active_mutation( mut ) ) ||
+                ( mut_data.inactive_flags.count( flag ) > 0 && !has_active_mutation( mut ) ) ) {
+                ret++;
+            }
+        }
+    }
+    for( const bionic &bio : *my_bionics ) {
+        if( bio.info().has_flag( flag ) ) {
+            ret++;
+        }
+        if( bio.info().activated ) {
+            if( ( bio.info().has_active_flag( flag ) && has_active_bionic( bio.id ) ) ||
+                ( bio.info().has_inactive_flag( flag ) && !has_active_bionic( bio.id ) ) ) {
+                ret++;
+            }
+        }
+    }
+    return ret +
            has_effect_with_flag( flag ) +
            count_bodypart_with_flag( flag ) +
            count_mabuff_flag( flag );
 }
 
+bool Character::has_flag( const json_character_flag &flag ) const
+{
+    using source = character_flag_index::source;
+    const bool ret = indexed_flag_count( source::trait, flag ) > 0 ||
+                     indexed_flag_count( source::bionic, flag ) > 0 ||
+                     indexed_flag_count( source::effect, flag ) > 0 ||
+                     indexed_flag_count( source::bodypart, flag ) > 0 ||
+                     ( flag_index.is_conditional( flag ) && has_bodypart_with_flag( flag ) ) ||
+                     indexed_flag_count( source::mabuff, flag ) > 0;
+    if( debug_mode && ret != ( count_flag_uncached( flag ) > 0 ) ) {
+        debugmsg( "Flag index of %s is out of date: has_flag( %s ) returned %s", get_name(),
+                  flag.str(), ret ? "true" : "false" );
+    }
+    return ret;
+}
+
+int Character::count_flag( const json_character_flag &flag ) const
+{
+    using source = character_flag_index::source;
+    int ret = indexed_flag_count( source::trait, flag ) +
+              indexed_flag_count( source::bionic, flag ) +
+              std::min( indexed_flag_count( source::effect, flag ), 1 ) +
+              indexed_flag_count( source::mabuff, flag );
+    // Only body parts with a conditional flag need to be looked at
+    const int bodypart_count = indexed_flag_count( source::bodypart, flag );
+    ret += flag_index.is_conditional( flag ) ? count_bodypart_with_flag( flag ) : bodypart_count;
+    if( debug_mode ) {
+        const int expected = count_flag_uncached( flag );
+        if( ret != expected ) {
+            debugmsg( "Flag index of %s is out of date: count_flag( %s ) returned %d instead of %d",
+                      get_name(), flag.str(), ret, expected );
+        }
+    }
+    return ret;
+}
+
 bool Character::empathizes_with_species( const species_id &species ) const
 {
     if( has_flag( STATIC( json_character_flag( "CANNIBAL" ) ) ) || has_flag( json_flag_PSYCHOPATH ) ||
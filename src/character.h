@@ -11,7 +11,6 @@
 #include <list>
 #include <map>
 #include <optional>
-#include <queue>
 #include <set>
 #include <string>
 #include <tuple>
@@ -27,6 +26,7 @@
 #include "calendar.h"
 #include "cata_utility.h"
 #include "character_attire.h"
+#include "character_flag_index.h"
 #include "character_id.h"
 #include "city.h"  // IWYU pragma: keep
 #include "compatibility.h"
@@ -54,6 +54,7 @@
 #include "stomach.h"
 #include "string_formatter.h"
 #include "subbodypart.h"
+#include "timer_wheel.h"
 #include "type_id.h"
 #include "units.h"
 #include "visitable.h"
@@ -297,21 +298,10 @@ struct queued_eoc {
         global_variables::impl_t context;
 };
 
-struct eoc_compare {
-    bool operator()( const queued_eoc &lhs, const queued_eoc &rhs ) const {
-        return lhs.time > rhs.time;
-    }
-};
-
 struct queued_eocs {
     using storage_iter = std::list<queued_eoc>::iterator;
 
-    struct eoc_compare : ::eoc_compare {
-        bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
-            return ::eoc_compare::operator()( *lhs, *rhs );
-        }
-    };
-    std::priority_queue<storage_iter, std::vector<storage_iter>, eoc_compare> queue;
+    timer_wheel<storage_iter> wheel;
     std::list<queued_eoc> list;
 
     queued_eocs() = default;
@@ -319,48 +309,55 @@ struct queued_eocs {
     queued_eocs( const queued_eocs &rhs ) {
         list = rhs.list;
         for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
+            schedule( it );
         }
     };
     queued_eocs( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
+        std::swap( wheel, rhs.wheel );
         list.swap( rhs.list );
     }
 
     queued_eocs &operator=( const queued_eocs &rhs ) {
         list = rhs.list;
-        // Why doesn't std::priority_queue have a clear() function.
-        queue = {};
+        wheel.clear();
         for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-            queue.emplace( it );
+            schedule( it );
         }
         return *this;
     }
     queued_eocs &operator=( queued_eocs &&rhs ) noexcept {
-        queue.swap( rhs.queue );
+        std::swap( wheel, rhs.wheel );
         list.swap( rhs.list );
         return *this;
     }
 
-    /* std::priority_queue compatibility layer where performance is less relevant */
-
     bool empty() const {
-        return queue.empty();
+        return wheel.empty();
     }
 
-    const queued_eoc &top() const {
-        return *queue.top();
+    void push( const queued_eoc &eoc ) {
+        schedule( list.emplace( list.end(), eoc ) );
     }
 
-    void push( const queued_eoc &eoc ) {
-        auto it = list.emplace( list.end(), eoc );
-        queue.push( it );
+    /** Schedules an entry of list again, after take_due handed it out. */
+    void schedule( storage_iter it ) {
+        wheel.insert( to_turn<int>( it->time ), it );
+    }
+
+    /**
+     * Appends all entries due at or before @p now to @p out, earliest first. They stay in list
+     * until erased or scheduled again.
+     */
+    void take_due( const time_point &now, std::vector<storage_iter> &out ) {
+        wheel.expire( to_turn<int>( now ), out );
     }
 
-    void pop() {
-        auto it = queue.top();
-        queue.pop();
-        list.erase( it );
+    /** Removes all scheduled entries, entries currently handed out by take_due are kept. */
+    void clear() {
+        wheel.for_each( [this]( int, const storage_iter & it ) {
+            list.erase( it );
+        } );
+        wheel.clear();
     }
 };
 
@@ -1408,9 +1405,52 @@ class Character : public Creature, public visitable
         /** Whether the character feels significant empathy for the given monster.  HUMAN is empathized with by default */
         bool empathizes_with_monster( const mtype_id &monster ) const;
 
+    protected:
+        /** Marks all sources of character flags to be counted again. */
+        void invalidate_flag_index();
+
     private:
-        // Cache if character has a flag on their mutations. It is cleared whenever my_mutations is modified.
-        mutable std::map<const json_character_flag, bool> trait_flag_cache;
+        // Where an enchantment visited by visit_enchantments comes from
+        enum class enchantment_origin : int {
+            item_proc,
+            item,
+            bionic,
+            effect,
+            // Mutations granting other mutations, visited before the granted ones are known
+            mutation_grant,
+            mutation,
+        };
+        /**
+         * Calls @p fn( ench, source, active, origin ) for every enchantment the character may get,
+         * in the order they are added to the enchantment cache. @p source is the item the
+         * enchantment is on, or nullptr. @p before_mutations is called after mutation_grant and
+         * before mutation enchantments are visited.
+         */
+        template<typename Fn, typename Between>
+        void visit_enchantments( Fn &&fn, Between &&before_mutations );
+        struct enchantment_source {
+            const enchantment *ench;
+            const item *source;
+            bool active;
+            bool operator==( const enchantment_source &rhs ) const {
+                return ench == rhs.ench && source == rhs.source && active == rhs.active;
+            }
+        };
+        // The enchantments considered by the last recalculate_enchantment_cache
+        std::vector<enchantment_source> enchantment_sources; // NOLINT(cata-serialize)
+        // Whether an active enchantment has values that are evaluated for the character
+        bool enchantment_values_variable = true; // NOLINT(cata-serialize)
+
+        // Counts of the flags of each source, see character_flag_index. The trait counts are
+        // invalidated whenever my_mutations is modified or a mutation is (de)activated, the
+        // bionic counts when bionics are added, removed, activated or deactivated.
+        mutable character_flag_index flag_index;
+        /** Counts the flags of @p src again. */
+        void update_flag_index( character_flag_index::source src ) const;
+        /** Count of @p flag from @p src, counting that source again first if needed. */
+        int indexed_flag_count( character_flag_index::source src, const json_character_flag &flag ) const;
+        /** count_flag computed from every source directly, to check the index against. */
+        int count_flag_uncached( const json_character_flag &flag ) const;
 
     public:
         /** Returns the trait id with the given invlet, or an empty string if no trait has that invlet */
@@ -1472,7 +1512,7 @@ class Character : public Creature, public visitable
         float get_limb_score( const limb_score_id &score,
                               const body_part_type::type &bp = body_part_type::type::num_types,
                               int override_encumb = -1, int override_wounds = -1 ) const;
-        float manipulator_score( const std::map<bodypart_str_id, bodypart> &body,
+        float manipulator_score( const bodypart_flat_map &body,
                                  body_part_type::type type, int override_encumb, int override_wounds ) const;
 
         bool has_min_manipulators() const;
@@ -1576,6 +1616,9 @@ class Character : public Creature, public visitable
         void recalculate_bodyparts();
         // recalculates enchantment cache by iterating through all held, worn, and wielded items
         void recalculate_enchantment_cache();
+        // recalculates the enchantment cache only if an enchantment was gained, lost, switched on or off
+        // or depends on values that may have changed since; called every turn
+        void update_enchantment_cache();
         // gets add and mult value from enchantment cache
 
         /** Returns true if the player has any martial arts buffs attached */
@@ -3227,6 +3270,8 @@ class Character : public Creature, public visitable
         /** Called when effect intensity has been changed */
         void on_effect_int_change( const efftype_id &eid, int intensity,
                                    const bodypart_id &bp = bodypart_str_id::NULL_ID() ) override;
+        /** Called when body parts have been added or removed */
+        void on_body_changed() override;
         /** Called when a mutation is gained */
         void on_mutation_gain( const trait_id &mid );
         /** Called when a mutation is lost */
@@ -3773,8 +3818,6 @@ class Character : public Creature, public visitable
         float leak_level = 0.0f;
         /** Signify that leak_level needs refreshing. Set to true on inventory change. */
         bool leak_level_dirty = true;
-        // Cache if current bionic layout has certain json flag. Refreshed upon bionics add/remove, activation/deactivation.
-        mutable std::map<const json_character_flag, bool> bio_flag_cache;
     public:
         float get_leak_level() const;
         /** Iterate through the character inventory to get its leak level */
@@ -3810,10 +3853,11 @@ class Character : public Creature, public visitable
         void add_known_trap( const tripoint_bub_ms &pos, const trap &t );
 
         // see Creature::sees
+        using Creature::sees;
         bool sees( const map &here, const tripoint_bub_ms &t, bool is_avatar = false,
                    int range_mod = 0 ) const override;
         // see Creature::sees
-        bool sees( const map &here, const Creature &critter ) const override;
+        bool sees_uncached( const map &here, const Creature &critter ) const override;
         Attitude attitude_to( const Creature &other ) const override;
         virtual npc_attitude get_attitude() const;
 
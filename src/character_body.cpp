@@ -249,7 +249,7 @@ void Character::update_body( const time_point &from, const time_point &to )
         oxygen = std::min( oxygen, get_oxygen_max() );
     }
     update_stomach( from, to );
-    recalculate_enchantment_cache();
+    update_enchantment_cache();
     if( ticks_between( from, to, 3_minutes ) > 0 ) {
         magic->update_mana( *this, to_turns<float>( 3_minutes ) );
     }
@@ -0,0 +1,90 @@
+#pragma once
+#ifndef CATA_SRC_CHARACTER_FLAG_INDEX_H
+#define CATA_SRC_CHARACTER_FLAG_INDEX_H
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "string_id.h"
+#include "type_id.h"
+
+/**
+ * Reference counts of the character flags a character gets from each of its sources, so that
+ * Character::has_flag and Character::count_flag do not walk every trait, bionic, effect and
+ * body part on each query.
+ *
+ * A source is counted again on the first query after it was invalidated, which happens when
+ * traits, bionics, effects, martial arts buffs or body parts are gained, lost, activated or
+ * deactivated. Changes in effect intensity do not change the flags and keep the counts.
+ * Flags that body parts only have depending on their health and encumbrance can not be
+ * counted ahead; the index only remembers which flags those are.
+ */
+class character_flag_index
+{
+    public:
+        enum class source : int {
+            trait,
+            bionic,
+            effect,
+            // Martial arts buffs, which are effects too
+            mabuff,
+            bodypart,
+            last
+        };
+
+        bool valid( source src ) const {
+            return valid_[static_cast<size_t>( src )];
+        }
+        void invalidate( source src ) {
+            valid_[static_cast<size_t>( src )] = false;
+        }
+        void invalidate_all() {
+            valid_ = {};
+        }
+
+        /** Drops the counts of @p src so they can be counted again, and marks it valid. */
+        void reset( source src ) {
+            counts_[static_cast<size_t>( src )].clear();
+            if( src == source::effect ) {
+                effect_types.clear();
+            } else if( src == source::bodypart ) {
+                conditional.clear();
+            }
+            valid_[static_cast<size_t>( src )] = true;
+        }
+        void add( source src, const json_character_flag &flag ) {
+            counts_[static_cast<size_t>( src )][flag]++;
+        }
+        int count( source src, const json_character_flag &flag ) const {
+            const std::unordered_map<json_character_flag, int> &counts = counts_[static_cast<size_t>( src )];
+            const auto it = counts.find( flag );
+            return it == counts.end() ? 0 : it->second;
+        }
+
+        /** Remembers that the effect counts include the flags of @p eff. */
+        void add_effect_type( const efftype_id &eff ) {
+            effect_types.insert( eff );
+        }
+        bool has_effect_type( const efftype_id &eff ) const {
+            return effect_types.count( eff ) > 0;
+        }
+
+        /** Remembers that a body part may have @p flag depending on its state. */
+        void add_conditional( const json_character_flag &flag ) {
+            conditional.insert( flag );
+        }
+        bool is_conditional( const json_character_flag &flag ) const {
+            return conditional.count( flag ) > 0;
+        }
+
+    private:
+        static constexpr size_t num_sources = static_cast<size_t>( source::last );
+        std::array<std::unordered_map<json_character_flag, int>, num_sources> counts_;
+        std::array<bool, num_sources> valid_ = {};
+        std::unordered_set<efftype_id> effect_types;
+        std::unordered_set<json_character_flag> conditional;
+};
+
+#endif // CATA_SRC_CHARACTER_FLAG_INDEX_H
@@ -159,7 +159,7 @@ void character_modifier::load( const JsonObject &jo, std::string_view )
 // Scores
 
 // the total of the manipulator score in the best limb group
-float Character::manipulator_score( const std::map<bodypart_str_id, bodypart> &body,
+float Character::manipulator_score( const bodypart_flat_map &body,
                                     body_part_type::type type, int override_encumb, int override_wounds ) const
 {
     std::map<body_part_type::type, std::vector<std::pair<bodypart, float>>> bodypart_groups;
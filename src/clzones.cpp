@@ -103,6 +103,7 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    item_zone_types.reset();
 }
 
 std::string zone_type::name() const
@@ -887,9 +888,17 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
     return type_iter != area_cache.end();
 }
 
+void zone_point_cache::insert( const tripoint_abs_ms &p )
+{
+    if( points.insert( p ).second ) {
+        buckets[project_to<coords::sm>( p )].push_back( p );
+    }
+}
+
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    item_zone_types.reset();
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.pos_abs();
     for( zone_data &elem : zones ) {
@@ -945,6 +954,7 @@ void zone_manager::cache_avatar_location()
 void zone_manager::cache_vzones( map *pmap )
 {
     vzone_cache.clear();
+    item_zone_types.reset();
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -965,12 +975,13 @@ void zone_manager::cache_vzones( map *pmap )
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
+const zone_point_cache &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const zone_point_cache empty;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return empty;
     }
 
     return type_iter->second;
@@ -987,34 +998,26 @@ std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const trip
 {
     std::unordered_set<tripoint_bub_ms> res;
     map &here = get_map();
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : area_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
-                    res.emplace( here.get_bub( point ) );
-                }
-            }
-        }
-    }
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
+    const auto add_loot_points = [&]( const std::unordered_map<std::string, zone_point_cache> &caches ) {
+        for( const std::pair<const std::string, zone_point_cache> &cache : caches ) {
+            zone_type_id type = zone_data::unhash_type( cache.first );
+            faction_id z_fac = zone_data::unhash_fac( cache.first );
+            if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
+                cache.second.find_near( where, radius, [&]( const tripoint_abs_ms & point ) {
                     res.emplace( here.get_bub( point ) );
-                }
+                    return false;
+                } );
             }
         }
-    }
+    };
+    add_loot_points( area_cache );
+    add_loot_points( vzone_cache );
 
     if( npc_search ) {
-        for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
+        for( const std::pair<const std::string, zone_point_cache> &cache : vzone_cache ) {
             zone_type_id type = zone_data::unhash_type( cache.first );
             if( type == zone_type_NO_NPC_PICKUP ) {
-                for( tripoint_abs_ms point : cache.second ) {
+                for( const tripoint_abs_ms &point : cache.second.get_points() ) {
                     res.erase( here.get_bub( point ) );
                 }
             }
@@ -1024,13 +1027,14 @@ std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const trip
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
+const zone_point_cache &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const zone_point_cache empty;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return empty;
     }
 
     return type_iter->second;
@@ -1039,31 +1043,21 @@ std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type
 bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
                         const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    const auto &vzone_set = get_vzone_set( type, fac );
-    return point_set.find( where ) != point_set.end() || vzone_set.find( where ) != vzone_set.end();
+    return get_point_set( type, fac ).contains( where ) || get_vzone_set( type, fac ).contains( where );
 }
 
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            return true;
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
-        }
+    const auto any = []( const tripoint_abs_ms & ) {
+        return true;
+    };
+    if( get_point_set( type, fac ).find_near( where, range, any ) ) {
+        return true;
     }
-
-    return false;
+    return get_vzone_set( type, fac ).find_near( where, range, [&where]( const tripoint_abs_ms & point ) {
+        return point.z() == where.z();
+    } );
 }
 
 std::vector<zone_data const *> zone_manager::get_near_zones( const zone_type_id &type,
@@ -1170,29 +1164,24 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     std::unordered_set<tripoint_abs_ms> near_point_set;
-
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                near_point_set.insert( point );
-            }
-        }
+    const bool filtered = type == zone_type_LOOT_CUSTOM || type == zone_type_LOOT_ITEM_GROUP;
+    if( filtered && it == nullptr ) {
+        return near_point_set;
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                    ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                    near_point_set.insert( point );
-                }
-            }
+    get_point_set( type, fac ).find_near( where, range, [&]( const tripoint_abs_ms & point ) {
+        if( !filtered || custom_loot_has( point, it, type, fac ) ) {
+            near_point_set.insert( point );
         }
-    }
+        return false;
+    } );
+    get_vzone_set( type, fac ).find_near( where, range, [&]( const tripoint_abs_ms & point ) {
+        if( point.z() == where.z() && ( !filtered || custom_loot_has( point, it, type, fac ) ) ) {
+            near_point_set.insert( point );
+        }
+        return false;
+    } );
 
     return near_point_set;
 }
@@ -1206,28 +1195,17 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
     tripoint_abs_ms nearest_pos( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint_abs_ms> &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &p : point_set ) {
+    const auto closer = [&]( const tripoint_abs_ms & p ) {
         int cur_dist = square_dist( p, where );
         if( cur_dist < nearest_dist ) {
             nearest_dist = cur_dist;
             nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
-    }
-
-    const std::unordered_set<tripoint_abs_ms> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
         }
+        return nearest_dist == 0;
+    };
+    if( get_point_set( type, fac ).find_near( where, range, closer ) ||
+        get_vzone_set( type, fac ).find_near( where, range, closer ) ) {
+        return nearest_pos;
     }
     if( nearest_dist > range ) {
         return std::nullopt;
@@ -1237,6 +1215,28 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
 zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
         const tripoint_abs_ms &where, int range, const faction_id &fac ) const
+{
+    if( !item_zone_types || item_zone_types->where != where || item_zone_types->range != range ||
+        item_zone_types->fac != fac ) {
+        item_zone_types.emplace( where, range, fac );
+        item_zone_types->has_custom = has_near( zone_type_LOOT_CUSTOM, where, range, fac ) ||
+                                      has_near( zone_type_LOOT_ITEM_GROUP, where, range, fac );
+    }
+    // Without contents or flags of its own the decision only depends on the item type
+    if( item_zone_types->has_custom || !it.get_contents().empty() || !it.get_flags().empty() ) {
+        return find_near_zone_type_for_item( it, where, range, fac );
+    }
+    const auto cached = item_zone_types->types.find( it.typeId() );
+    if( cached != item_zone_types->types.end() ) {
+        return cached->second;
+    }
+    const zone_type_id type = find_near_zone_type_for_item( it, where, range, fac );
+    item_zone_types->types.emplace( it.typeId(), type );
+    return type;
+}
+
+zone_type_id zone_manager::find_near_zone_type_for_item( const item &it,
+        const tripoint_abs_ms &where, int range, const faction_id &fac ) const
 {
     const item_category &cat = it.get_category_of_contents();
 
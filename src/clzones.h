@@ -2,7 +2,9 @@
 #ifndef CATA_SRC_CLZONES_H
 #define CATA_SRC_CLZONES_H
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -539,6 +541,80 @@ class zone_data
         void deserialize( const JsonObject &data );
 };
 
+/**
+ * The points covered by the zones of one type and faction. Points are also bucketed by
+ * submap, so range queries only look at the submaps that can hold points in range.
+ */
+class zone_point_cache
+{
+    public:
+        void insert( const tripoint_abs_ms &p );
+        bool contains( const tripoint_abs_ms &p ) const {
+            return points.count( p ) > 0;
+        }
+        const std::unordered_set<tripoint_abs_ms> &get_points() const {
+            return points;
+        }
+        /**
+         * Calls @p fn( point ) on the points within square distance @p range of @p where,
+         * until it returns true. Returns whether it did.
+         */
+        template<typename Fn>
+        bool find_near( const tripoint_abs_ms &where, int range, Fn &&fn ) const;
+
+    private:
+        std::unordered_set<tripoint_abs_ms> points;
+        std::unordered_map<tripoint_abs_sm, std::vector<tripoint_abs_ms>> buckets;
+};
+
+template<typename Fn>
+bool zone_point_cache::find_near( const tripoint_abs_ms &where, int range, Fn &&fn ) const
+{
+    if( range < 0 || points.empty() ) {
+        return false;
+    }
+    const auto to_sm = []( int64_t v ) {
+        return v >= 0 ? v / SEEX : ( v - SEEX + 1 ) / SEEX;
+    };
+    const int64_t x0 = to_sm( static_cast<int64_t>( where.x() ) - range );
+    const int64_t x1 = to_sm( static_cast<int64_t>( where.x() ) + range );
+    const int64_t y0 = to_sm( static_cast<int64_t>( where.y() ) - range );
+    const int64_t y1 = to_sm( static_cast<int64_t>( where.y() ) + range );
+    const int64_t z0 = std::max<int64_t>( static_cast<int64_t>( where.z() ) - range, -OVERMAP_DEPTH );
+    const int64_t z1 = std::min<int64_t>( static_cast<int64_t>( where.z() ) + range, OVERMAP_HEIGHT );
+    const auto visit = [&]( const std::vector<tripoint_abs_ms> &bucket ) {
+        for( const tripoint_abs_ms &p : bucket ) {
+            if( square_dist( p, where ) <= range && fn( p ) ) {
+                return true;
+            }
+        }
+        return false;
+    };
+    // Look up every submap in range, unless there are fewer buckets than that
+    if( ( x1 - x0 + 1 ) * ( y1 - y0 + 1 ) * ( z1 - z0 + 1 ) > static_cast<int64_t>( buckets.size() ) ) {
+        for( const auto &bucket : buckets ) {
+            const tripoint_abs_sm &sm = bucket.first;
+            if( sm.x() >= x0 && sm.x() <= x1 && sm.y() >= y0 && sm.y() <= y1 &&
+                sm.z() >= z0 && sm.z() <= z1 && visit( bucket.second ) ) {
+                return true;
+            }
+        }
+        return false;
+    }
+    for( int64_t z = z0; z <= z1; z++ ) {
+        for( int64_t y = y0; y <= y1; y++ ) {
+            for( int64_t x = x0; x <= x1; x++ ) {
+                const auto bucket = buckets.find( tripoint_abs_sm( static_cast<int>( x ), static_cast<int>( y ),
+                                                  static_cast<int>( z ) ) );
+                if( bucket != buckets.end() && visit( bucket->second ) ) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 class zone_manager
 {
     public:
@@ -562,13 +638,29 @@ class zone_manager
         int num_personal_zones = 0; // NOLINT(cata-serialize)
 
         // NOLINTNEXTLINE(cata-serialize)
-        std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
+        std::unordered_map<std::string, zone_point_cache> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
-        std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
+        std::unordered_map<std::string, zone_point_cache> vzone_cache;
+        const zone_point_cache &get_point_set( const zone_type_id &type,
+                                               const faction_id &fac = your_fac ) const;
+        const zone_point_cache &get_vzone_set( const zone_type_id &type,
+                                               const faction_id &fac = your_fac ) const;
+
+        // Zone types picked for items that only depend on their type, while sorting from one place
+        struct item_zone_type_cache {
+            item_zone_type_cache( const tripoint_abs_ms &where, int range, const faction_id &fac ) :
+                where( where ), range( range ), fac( fac ) {}
+
+            tripoint_abs_ms where;
+            int range;
+            faction_id fac;
+            // Custom filters look at more than the item type, nothing is cached with them around
+            bool has_custom = false;
+            std::unordered_map<itype_id, zone_type_id> types;
+        };
+        mutable std::optional<item_zone_type_cache> item_zone_types; // NOLINT(cata-serialize)
+        zone_type_id find_near_zone_type_for_item( const item &it, const tripoint_abs_ms &where,
+                int range, const faction_id &fac ) const;
     public:
         zone_manager();
         ~zone_manager() = default;
@@ -479,6 +479,32 @@ static bool majority_rule( const bool a_vote, const bool b_vote, const bool c_vo
 }
 
 bool Creature::sees( const map &here, const Creature &critter ) const
+{
+    // Other maps are only looked at in rare cases that are not worth remembering
+    if( &here != &get_map() || &critter == this ) {
+        return sees_uncached( here, critter );
+    }
+
+    const int epoch = get_creature_tracker().get_visibility_epoch();
+    if( sees_memo_owner != this || sees_memo_turn != calendar::turn || sees_memo_epoch != epoch ) {
+        sees_memo.clear();
+        sees_memo_owner = this;
+        sees_memo_turn = calendar::turn;
+        sees_memo_epoch = epoch;
+    }
+
+    const tripoint_abs_ms pos = pos_abs();
+    const tripoint_abs_ms target_pos = critter.pos_abs();
+    const auto it = sees_memo.find( &critter );
+    if( it != sees_memo.end() && it->second.pos == pos && it->second.target_pos == target_pos ) {
+        return it->second.seen;
+    }
+    const bool seen = sees_uncached( here, critter );
+    sees_memo[&critter] = { pos, target_pos, seen };
+    return seen;
+}
+
+bool Creature::sees_uncached( const map &here, const Creature &critter ) const
 {
     const Character *ch = critter.as_character();
 
@@ -723,18 +749,21 @@ Creature *Creature::auto_find_hostile_target( int range, int &boo_hoo, int area
         self_area_iff = true;
     }
 
-    std::vector<Creature *> targets = g->get_creatures_if( [&]( const Creature & critter ) {
-        if( critter.is_monster() ) {
-            // friendly to the player, not a target for us
-            return static_cast<const monster *>( &critter )->attitude( &player_character ) == MATT_ATTACK;
+    // Only monsters in range can be targeted, so there is no need to look at the rest
+    std::vector<Creature *> targets;
+    get_creature_tracker().for_each_monster_near( pos_abs(), range, [&]( monster & critter ) {
+        // friendly to the player, not a target for us
+        if( critter.attitude( &player_character ) == MATT_ATTACK ) {
+            targets.push_back( &critter );
         }
-        if( critter.is_npc() ) {
-            // friendly to the player, not a target for us
-            return static_cast<const npc *>( &critter )->get_attitude() == NPCATT_KILL;
-        }
-        // TODO: what about g->u?
-        return false;
     } );
+    for( npc &guy : g->all_npcs() ) {
+        // friendly to the player, not a target for us
+        if( guy.get_attitude() == NPCATT_KILL ) {
+            targets.push_back( &guy );
+        }
+    }
+    // TODO: what about g->u?
     for( Creature *&m : targets ) {
         if( !sees( here, *m ) ) {
             // can't see nor sense it
@@ -1603,6 +1632,8 @@ bool Creature::stumble_invis( const Creature &player, const bool stumblemsg )
         here.set_field_age( player.pos_bub( here ), field_fd_last_known, 0_seconds );
     } else {
         here.add_field( player.pos_bub( here ), field_fd_last_known );
+        // Creatures stumbling into the player see them where this field is
+        get_creature_tracker().invalidate_visibility_cache();
     }
     moves = 0;
     return true;
@@ -1633,6 +1664,7 @@ bool Creature::attack_air( const tripoint_bub_ms &p )
     // Chance to remove last known location
     if( one_in( 2 ) ) {
         get_map().set_field_intensity( p, field_fd_last_known, 0 );
+        get_creature_tracker().invalidate_visibility_cache();
     }
 
     add_msg_if_player_sees( *this, _( "%s attacks, but there is nothing there!" ),
@@ -1905,6 +1937,11 @@ bool Creature::add_env_effect( const efftype_id &eff_id, const bodypart_id &vect
                            intensity, force );
 }
 
+void Creature::on_effect_int_change( const efftype_id &, int, const bodypart_id & )
+{
+    get_creature_tracker().invalidate_visibility_cache();
+}
+
 void Creature::clear_effects()
 {
     for( auto &elem : *effects ) {
@@ -2377,17 +2414,15 @@ void Creature::set_anatomy( const anatomy_id &anat )
     creature_anatomy = anat;
 }
 
-const std::map<bodypart_str_id, bodypart> &Creature::get_body() const
+const bodypart_flat_map &Creature::get_body() const
 {
     return body;
 }
 
 void Creature::set_body()
 {
-    body.clear();
-    for( const bodypart_id &bp : get_anatomy()->get_bodyparts() ) {
-        body.emplace( bp.id(), bodypart( bp.id() ) );
-    }
+    body.assign( get_anatomy()->get_sorted_bodyparts() );
+    on_body_changed();
 }
 
 bool Creature::has_part( const bodypart_id &id, body_part_filter filter ) const
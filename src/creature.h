@@ -13,6 +13,7 @@
 #include <set>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -395,12 +396,18 @@ class Creature : public viewer
          * The function that take another creature as input should check visibility of that creature
          * (e.g. not digging, or otherwise invisible). They must than check whether the location of
          * the other monster is visible.
+         *
+         * Whether a creature sees another one on the main map is remembered until the end of the
+         * turn, as long as neither of them moves and nothing else it depends on changes, see
+         * creature_tracker::invalidate_visibility_cache. Subclasses override sees_uncached.
          */
         /*@{*/
-        bool sees( const map &here, const Creature &critter ) const override;
+        bool sees( const map &here, const Creature &critter ) const final;
         bool sees( const map &here, const tripoint_bub_ms &t, bool is_avatar = false,
                    int range_mod = 0 ) const override;
         /*@}*/
+        /** Checks whether this creature can see @p critter without looking at the remembered results. */
+        virtual bool sees_uncached( const map &here, const Creature &critter ) const;
 
         /**
          * How far the creature sees under the given light. Creature cannot see places outside this range.
@@ -811,7 +818,7 @@ class Creature : public viewer
         /**anatomy is the plan of the creature's body*/
         anatomy_id creature_anatomy = anatomy_id( "default_anatomy" );
         /**this is the actual body of the creature*/
-        std::map<bodypart_str_id, bodypart> body;
+        bodypart_flat_map body;
     public:
         anatomy_id get_anatomy() const;
         void set_anatomy( const anatomy_id &anat );
@@ -845,7 +852,7 @@ class Creature : public viewer
         /* Returns the number of broken bodyparts of a given type */
         int get_num_broken_body_parts_of_type( body_part_type::type part_type ) const;
 
-        const std::map<bodypart_str_id, bodypart> &get_body() const;
+        const bodypart_flat_map &get_body() const;
         void set_body();
         // Does not fire debug message if part does not exist
         bool has_part( const bodypart_id &id, body_part_filter filter = body_part_filter::strict ) const;
@@ -1275,7 +1282,9 @@ class Creature : public viewer
         Creature &operator=( Creature && ) noexcept;
 
         virtual void on_stat_change( const std::string &, int ) {}
-        virtual void on_effect_int_change( const efftype_id &, int, const bodypart_id & ) {}
+        // Overrides must call this, effects change what other creatures see
+        virtual void on_effect_int_change( const efftype_id &eid, int intensity, const bodypart_id &bp );
+        virtual void on_body_changed() {}
         virtual void on_damage_of_type( const effect_source &, int, const damage_type_id &,
                                         const bodypart_id & ) {}
 
@@ -1352,6 +1361,20 @@ class Creature : public viewer
 
     private:
         int pain;
+
+        struct sees_result {
+            tripoint_abs_ms pos;
+            tripoint_abs_ms target_pos;
+            bool seen;
+        };
+        // Results of sees( critter ) for other creatures, valid for the turn and visibility epoch
+        // below and while both creatures stay at the positions they were at. The owner tells a
+        // copied creature that they were computed for another one.
+        mutable std::unordered_map<const Creature *, sees_result> sees_memo; // NOLINT(cata-serialize)
+        mutable const Creature *sees_memo_owner = nullptr; // NOLINT(cata-serialize)
+        mutable time_point sees_memo_turn; // NOLINT(cata-serialize)
+        mutable int sees_memo_epoch = -1; // NOLINT(cata-serialize)
+
         // calculate how well the projectile hits
         double accuracy_projectile_attack( const int &speed, const double &missed_by ) const;
         // what bodypart does the projectile hit
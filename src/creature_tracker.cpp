@@ -94,6 +94,9 @@ bool creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
 
     monsters_list.emplace_back( critter_ptr );
     monsters_by_location[critter.pos_abs()] = critter_ptr;
+    monsters_by_submap[coords::project_to<coords::sm>( critter.pos_abs().xy() )].push_back( {
+        critter.pos_abs(), &critter } );
+    invalidate_visibility_cache();
     return true;
 }
 
@@ -107,6 +110,9 @@ bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms
 {
     map &here = get_map();
 
+    // The grid follows where the monster actually is, dead or not
+    move_in_submap_grid( critter, old_pos, new_pos );
+
     if( critter.is_dead() ) {
         // find ignores dead critters anyway, changing their position in the
         // monsters_by_location map is useless.
@@ -163,6 +169,66 @@ void creature_tracker::remove_from_location_map( const monster &critter )
     }
 }
 
+void creature_tracker::move_in_submap_grid( const monster &critter,
+        const tripoint_abs_ms &old_pos, const tripoint_abs_ms &new_pos )
+{
+    const point_abs_sm old_sm = coords::project_to<coords::sm>( old_pos.xy() );
+    const point_abs_sm new_sm = coords::project_to<coords::sm>( new_pos.xy() );
+    if( old_sm != new_sm ) {
+        if( remove_from_submap_grid( critter, old_pos ) ) {
+            // The tracker owns the monster, it is only const to the caller
+            monsters_by_submap[new_sm].push_back( { new_pos, const_cast<monster *>( &critter ) } );
+        }
+        return;
+    }
+    const auto bucket = monsters_by_submap.find( new_sm );
+    if( bucket != monsters_by_submap.end() ) {
+        for( located_monster &entry : bucket->second ) {
+            if( entry.critter == &critter ) {
+                entry.pos = new_pos;
+                return;
+            }
+        }
+    }
+}
+
+bool creature_tracker::remove_from_submap_grid( const monster &critter, const tripoint_abs_ms &pos )
+{
+    const auto erase_from = [this, &critter]( decltype( monsters_by_submap )::iterator bucket ) {
+        std::vector<located_monster> &entries = bucket->second;
+        const auto iter = std::find_if( entries.begin(), entries.end(),
+        [&critter]( const located_monster & entry ) {
+            return entry.critter == &critter;
+        } );
+        if( iter == entries.end() ) {
+            return false;
+        }
+        entries.erase( iter );
+        if( entries.empty() ) {
+            monsters_by_submap.erase( bucket );
+        }
+        return true;
+    };
+
+    const auto bucket = monsters_by_submap.find( coords::project_to<coords::sm>( pos.xy() ) );
+    if( bucket != monsters_by_submap.end() && erase_from( bucket ) ) {
+        return true;
+    }
+    // When it's not on the submap it is expected on, it may have been moved without telling
+    // the tracker, so look for it.
+    for( auto iter = monsters_by_submap.begin(); iter != monsters_by_submap.end(); ++iter ) {
+        if( erase_from( iter ) ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool creature_tracker::is_alive( const monster &critter )
+{
+    return !critter.is_dead();
+}
+
 void creature_tracker::remove( const monster &critter )
 {
     const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
@@ -175,24 +241,31 @@ void creature_tracker::remove( const monster &critter )
     }
 
     remove_from_location_map( critter );
+    remove_from_submap_grid( critter, critter.pos_abs() );
     removed_this_turn_.emplace( *iter );
     monsters_list.erase( iter );
+    invalidate_visibility_cache();
 }
 
 void creature_tracker::clear()
 {
     monsters_list.clear();
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     removed_this_turn_.clear();
     creatures_by_zone_and_faction_.clear();
     invalidate_reachability_cache();
+    invalidate_visibility_cache();
 }
 
 void creature_tracker::rebuild_cache()
 {
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
         monsters_by_location[mon_ptr->pos_abs()] = mon_ptr;
+        monsters_by_submap[coords::project_to<coords::sm>( mon_ptr->pos_abs().xy() )].push_back( {
+            mon_ptr->pos_abs(), mon_ptr.get() } );
     }
 }
 
@@ -245,9 +318,12 @@ void creature_tracker::swap_positions( monster &first, monster &second )
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
-    const tripoint_abs_ms temp = second.pos_abs();
-    second.spawn( first.pos_abs() );
-    first.spawn( temp );
+    const tripoint_abs_ms first_pos = first.pos_abs();
+    const tripoint_abs_ms second_pos = second.pos_abs();
+    second.spawn( first_pos );
+    first.spawn( second_pos );
+    move_in_submap_grid( first, first_pos, second_pos );
+    move_in_submap_grid( second, second_pos, first_pos );
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
@@ -290,6 +366,7 @@ void creature_tracker::remove_dead()
         monster *const critter = iter->get();
         if( critter->is_dead() ) {
             remove_from_location_map( *critter );
+            remove_from_submap_grid( *critter, critter->pos_abs() );
             iter = monsters_list.erase( iter );
         } else {
             ++iter;
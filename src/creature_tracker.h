@@ -70,6 +70,18 @@ class creature_tracker
         void for_each_reachable( const Creature &origin, FactionPredicateFn &&faction_fn,
                                  CreatureVisitFn &&creature_fn );
 
+        /**
+         * Visits the monsters within @p radius of @p center by square distance on the horizontal
+         * plane, on any z-level. Only the monsters on the submaps covering that square are looked
+         * at, see @ref monsters_by_submap.
+         *  - VisitFn: void(monster&)
+         * Dead monsters are ignored and not visited. The visitor must not add, remove or move
+         * monsters.
+         */
+        template <typename VisitFn>
+        void for_each_monster_near( const tripoint_abs_ms &center, int radius,
+                                    VisitFn &&visit_fn ) const;
+
         /**
          * Returns a temporary id of the given monster (which must exist in the tracker).
          * The id is valid until monsters are added or removed from the tracker.
@@ -133,9 +145,29 @@ class creature_tracker
             dirty_ = true;
         }
 
+        // This must be called when something Creature::sees( critter ) depends on changes within a
+        // turn, other than the positions of the two creatures: effects, light, transparency,
+        // terrain and furniture, movement modes or monster types. It makes every creature forget
+        // which creatures it has seen this turn.
+        void invalidate_visibility_cache() {
+            visibility_epoch_++;
+        }
+        int get_visibility_epoch() const {
+            return visibility_epoch_;
+        }
+
     private:
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
+        /** Moves the monsters entry in @ref monsters_by_submap along with the monster */
+        void move_in_submap_grid( const monster &critter, const tripoint_abs_ms &old_pos,
+                                  const tripoint_abs_ms &new_pos );
+        /**
+         * Remove the monsters entry in @ref monsters_by_submap, it is expected at @p pos.
+         * Returns whether it had one.
+         */
+        bool remove_from_submap_grid( const monster &critter, const tripoint_abs_ms &pos );
+        static bool is_alive( const monster &critter );
 
         void flood_fill_zone( const Creature &origin );
 
@@ -148,6 +180,17 @@ class creature_tracker
         std::vector<shared_ptr_fast<monster>> monsters_list;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>> monsters_by_location;
+        struct located_monster {
+            tripoint_abs_ms pos;
+            monster *critter;
+        };
+        /**
+         * The monsters of @ref monsters_list bucketed by the submap they are on, ignoring the
+         * z-level, in the order they were added to each bucket. Dead monsters stay until
+         * @ref remove_dead.
+         */
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<point_abs_sm, std::vector<located_monster>> monsters_by_submap;
 
         /**
          * Creatures that get removed via @ref remove are stored here until the end of the turn.
@@ -161,6 +204,8 @@ class creature_tracker
         bool dirty_ = true;  // NOLINT(cata-serialize)
         int zone_tick_ = 1;  // NOLINT(cata-serialize)
         int zone_number_ = 0;  // NOLINT(cata-serialize)
+        // Bumped by invalidate_visibility_cache, see Creature::sees
+        int visibility_epoch_ = 0;  // NOLINT(cata-serialize)
         std::unordered_map<int, std::unordered_map<mfaction_id, std::vector<shared_ptr_fast<Creature>>>>
         creatures_by_zone_and_faction_;  // NOLINT(cata-serialize)
 
@@ -228,4 +273,25 @@ void creature_tracker::for_each_reachable( const Creature &origin, FactionPredic
     } );
 }
 
+template <typename VisitFn>
+void creature_tracker::for_each_monster_near( const tripoint_abs_ms &center, const int radius,
+        VisitFn &&visit_fn ) const
+{
+    const point_abs_sm sm_min = coords::project_to<coords::sm>( center.xy() - point( radius, radius ) );
+    const point_abs_sm sm_max = coords::project_to<coords::sm>( center.xy() + point( radius, radius ) );
+    for( int y = sm_min.y(); y <= sm_max.y(); y++ ) {
+        for( int x = sm_min.x(); x <= sm_max.x(); x++ ) {
+            const auto iter = monsters_by_submap.find( point_abs_sm( x, y ) );
+            if( iter == monsters_by_submap.end() ) {
+                continue;
+            }
+            for( const located_monster &entry : iter->second ) {
+                if( square_dist( entry.pos.xy(), center.xy() ) <= radius && is_alive( *entry.critter ) ) {
+                    visit_fn( *entry.critter );
+                }
+            }
+        }
+    }
+}
+
 #endif // CATA_SRC_CREATURE_TRACKER_H
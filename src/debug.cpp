@@ -6,6 +6,8 @@
 // IWYU pragma: no_include <sys/unistd.h>
 #include <clocale>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <cstdio>
@@ -22,6 +24,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -50,6 +53,10 @@
 #include <sys/time.h>
 #endif
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#include "mingw.thread.h"
+#endif
+
 #if defined(_WIN32)
 #   if 1 // HACK: Hack to prevent reordering of #include "platform_win.h" by IWYU
 #       include "platform_win.h"
@@ -708,6 +715,173 @@ struct OutputDebugStreamA : public std::ostream {
 };
 #endif
 
+// Background Debug Log Writer                                      {{{2
+// ---------------------------------------------------------------------
+
+static int debug_log_flush_interval_ms = 100;
+
+/**
+ * Stream buffer handing the debug log to a background thread, so that logging a message
+ * does not wait for the disk.
+ *
+ * Text goes into a bounded ring of bytes without taking any lock. The writer thread empties
+ * it into the sink at least once per flush interval, or sooner when it fills up. In
+ * synchronous mode, used for errors, everything pending is written and flushed on each sync.
+ */
+class async_log_buf : public std::streambuf
+{
+    public:
+        async_log_buf( std::unique_ptr<std::ostream> sink, std::chrono::milliseconds interval );
+        ~async_log_buf() override;
+
+        void set_synchronous( bool sync ) {
+            synchronous = sync;
+        }
+        /**
+         * Writes everything pending to the sink from the calling thread. If @p wait_for_writer
+         * is false, it gives up waiting for the writer thread after a short while and writes
+         * anyway, for when the process is crashing.
+         */
+        void drain( bool wait_for_writer = true );
+
+    protected:
+        int_type overflow( int_type ch ) override;
+        std::streamsize xsputn( const char *s, std::streamsize n ) override;
+        int sync() override;
+
+    private:
+        void run();
+
+        static constexpr uint64_t capacity = 1 << 20;
+        std::unique_ptr<std::ostream> sink;
+        std::unique_ptr<char[]> ring;
+        // Bytes ever put into the ring and ever written out of it
+        std::atomic<uint64_t> head{ 0 };
+        std::atomic<uint64_t> tail{ 0 };
+        // Held by whoever writes to the sink
+        std::atomic_flag writing = ATOMIC_FLAG_INIT;
+        std::atomic<bool> stopping{ false };
+        bool synchronous = false;
+        std::chrono::milliseconds interval;
+        std::thread writer;
+};
+
+async_log_buf::async_log_buf( std::unique_ptr<std::ostream> sink,
+                              std::chrono::milliseconds interval ) :
+    sink( std::move( sink ) ), ring( new char[capacity] ), interval( interval ),
+    writer( &async_log_buf::run, this )
+{
+}
+
+async_log_buf::~async_log_buf()
+{
+    stopping = true;
+    writer.join();
+    drain();
+}
+
+void async_log_buf::run()
+{
+    std::chrono::steady_clock::time_point last_write = std::chrono::steady_clock::now();
+    while( !stopping ) {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+        const uint64_t pending = head.load( std::memory_order_acquire ) -
+                                 tail.load( std::memory_order_relaxed );
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if( pending > 0 && ( pending >= capacity / 2 || now - last_write >= interval ) ) {
+            drain();
+            last_write = now;
+        }
+    }
+}
+
+void async_log_buf::drain( bool wait_for_writer )
+{
+    bool locked = false;
+    for( int tries = 0; !locked && ( wait_for_writer || tries < 1000 ); tries++ ) {
+        locked = !writing.test_and_set( std::memory_order_acquire );
+        if( !locked ) {
+            std::this_thread::yield();
+        }
+    }
+    const uint64_t end = head.load( std::memory_order_acquire );
+    uint64_t pos = tail.load( std::memory_order_relaxed );
+    while( pos < end ) {
+        const uint64_t offset = pos % capacity;
+        const uint64_t len = std::min( end - pos, capacity - offset );
+        sink->write( ring.get() + offset, static_cast<std::streamsize>( len ) );
+        pos += len;
+    }
+    sink->flush();
+    tail.store( end, std::memory_order_release );
+    if( locked ) {
+        writing.clear( std::memory_order_release );
+    }
+}
+
+std::streamsize async_log_buf::xsputn( const char *s, std::streamsize n )
+{
+    const uint64_t count = static_cast<uint64_t>( n );
+    if( count > capacity - ( head.load( std::memory_order_relaxed ) -
+                             tail.load( std::memory_order_acquire ) ) ) {
+        // The writer fell behind, write out from here rather than dropping messages
+        drain();
+        if( count > capacity ) {
+            while( writing.test_and_set( std::memory_order_acquire ) ) {
+                std::this_thread::yield();
+            }
+            sink->write( s, n );
+            writing.clear( std::memory_order_release );
+            return n;
+        }
+    }
+    uint64_t pos = head.load( std::memory_order_relaxed );
+    const uint64_t end = pos + count;
+    while( pos < end ) {
+        const uint64_t offset = pos % capacity;
+        const uint64_t len = std::min( end - pos, capacity - offset );
+        std::copy_n( s, len, ring.get() + offset );
+        s += len;
+        pos += len;
+    }
+    head.store( end, std::memory_order_release );
+    return n;
+}
+
+async_log_buf::int_type async_log_buf::overflow( int_type ch )
+{
+    if( traits_type::eq_int_type( ch, traits_type::eof() ) ) {
+        return traits_type::not_eof( ch );
+    }
+    const char c = traits_type::to_char_type( ch );
+    xsputn( &c, 1 );
+    return ch;
+}
+
+int async_log_buf::sync()
+{
+    if( synchronous ) {
+        drain();
+    }
+    return 0;
+}
+
+class async_log_stream : public std::ostream
+{
+    public:
+        async_log_stream( std::unique_ptr<std::ostream> sink, std::chrono::milliseconds interval ) :
+            std::ostream( nullptr ), buf( std::move( sink ), interval ) {
+            rdbuf( &buf );
+        }
+
+        async_log_buf buf;
+};
+
+void setDebugLogFlushInterval( int interval_ms )
+{
+    debug_log_flush_interval_ms = interval_ms;
+}
+
 struct DebugFile {
     void init( DebugOutput, const cata_path &filename );
     void deinit();
@@ -722,6 +896,8 @@ struct DebugFile {
     // Using shared_ptr for the type-erased deleter support, not because
     // it needs to be shared.
     std::shared_ptr<std::ostream> file = std::make_shared<std::ostringstream>();
+    // The buffer of file if it is written in the background
+    async_log_buf *async = nullptr;
     cata_path filename;
 };
 
@@ -736,6 +912,7 @@ void DebugFile::deinit()
         *file << get_time() << " : Log shutdown.\n";
         *file << "-----------------------------------------\n\n";
     }
+    async = nullptr;
     file.reset();
 }
 
@@ -765,8 +942,17 @@ void DebugFile::init( DebugOutput output_mode, const cata_path &filename )
                 fs::rename( fs::path( filename ), fs::path( oldfile ), ec );
                 rename_failed = bool( ec );
             }
-            file = std::make_shared<std::ofstream>(
-                       filename.generic_u8string(), std::ios::out | std::ios::app );
+            if( debug_log_flush_interval_ms > 0 ) {
+                std::shared_ptr<async_log_stream> stream = std::make_shared<async_log_stream>(
+                            std::make_unique<std::ofstream>( filename.generic_u8string(),
+                                    std::ios::out | std::ios::app ),
+                            std::chrono::milliseconds( debug_log_flush_interval_ms ) );
+                async = &stream->buf;
+                file = std::move( stream );
+            } else {
+                file = std::make_shared<std::ofstream>(
+                           filename.generic_u8string(), std::ios::out | std::ios::app );
+            }
         }
         break;
         default:
@@ -847,6 +1033,16 @@ void deinitDebug()
     DebugFile::instance().deinit();
 }
 
+void flushDebugLog()
+{
+    DebugFile &debug_file = DebugFile::instance();
+    if( debug_file.async != nullptr ) {
+        debug_file.async->drain( false );
+    } else if( debug_file.file ) {
+        debug_file.file->flush();
+    }
+}
+
 // OStream Operators                                                {{{2
 // ---------------------------------------------------------------------
 
@@ -1510,7 +1706,12 @@ std::ostream &DebugLog( DebugLevel lev, DebugClass cl )
     // Error are always logged, they are important,
     // Messages from D_MAIN come from debugmsg and are equally important.
     if( ( lev & debugLevel && cl & debugClass ) || lev & D_ERROR || cl & D_MAIN ) {
-        std::ostream &out = DebugFile::instance().get_file();
+        DebugFile &debug_file = DebugFile::instance();
+        if( debug_file.async != nullptr ) {
+            // Errors reach the disk before DebugLog returns, in case the program dies next
+            debug_file.async->set_synchronous( lev & D_ERROR );
+        }
+        std::ostream &out = debug_file.get_file();
 
         output_repetitions( out );
 
@@ -1538,7 +1739,7 @@ std::ostream &DebugLog( DebugLevel lev, DebugClass cl )
         }
 #endif
 
-        out << std::unitbuf; // flush writes immediately
+        out << std::unitbuf; // flush writes immediately, or hand them to the background writer
         return out;
     }
 
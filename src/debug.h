@@ -188,6 +188,15 @@ enum class DebugOutput : int {
 void setupDebug( DebugOutput );
 /** Opposite of setupDebug, shuts the debugging system down. */
 void deinitDebug();
+/**
+ * How long debug log messages written to a file may wait before they reach the disk.
+ * With a positive interval a background thread writes them in batches, errors are still
+ * written before DebugLog returns. Zero writes and flushes every message immediately.
+ * Has to be called before setupDebug.
+ */
+void setDebugLogFlushInterval( int interval_ms );
+/** Writes all pending debug log messages, used when the program is about to die. */
+void flushDebugLog();
 
 // Function Declarations                                            {{{1
 // ---------------------------------------------------------------------
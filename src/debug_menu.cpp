@@ -103,6 +103,7 @@
 #include "overmapbuffer.h"
 #include "path_info.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "pimpl.h"
 #include "point.h"
 #include "popup.h"
@@ -231,6 +232,7 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::SHOW_MUT_CAT: return "SHOW_MUT_CAT";
         case debug_menu::debug_menu_index::OM_EDITOR: return "OM_EDITOR";
         case debug_menu::debug_menu_index::BENCHMARK: return "BENCHMARK";
+        case debug_menu::debug_menu_index::PROFILER_CAPTURE: return "PROFILER_CAPTURE";
         case debug_menu::debug_menu_index::OM_TELEPORT: return "OM_TELEPORT";
         case debug_menu::debug_menu_index::OM_TELEPORT_COORDINATES: return "OM_TELEPORT_COORDINATES";
         case debug_menu::debug_menu_index::OM_TELEPORT_CITY: return "OM_TELEPORT_CITY";
@@ -885,6 +887,10 @@ static int info_uilist( bool display_all_entries = true )
         { uilist_entry( debug_menu_index::SAVE_SCREENSHOT, true, 'H', _( "Take screenshot" ) ) },
         { uilist_entry( debug_menu_index::GAME_REPORT, true, 'r', _( "Generate game report" ) ) },
         { uilist_entry( debug_menu_index::GAME_MIN_ARCHIVE, true, '!', _( "Generate minimized save archive" ) ) },
+        {
+            uilist_entry( debug_menu_index::PROFILER_CAPTURE, true, 'P', cata_profiler::capturing() ?
+                          _( "Stop profiler capture" ) : _( "Start profiler capture" ) )
+        },
     };
 
     if( display_all_entries ) {
@@ -3957,6 +3963,7 @@ void debug()
         debug_menu_index::ENABLE_ACHIEVEMENTS,
         debug_menu_index::UNLOCK_ALL,
         debug_menu_index::BENCHMARK,
+        debug_menu_index::PROFILER_CAPTURE,
         debug_menu_index::SHOW_MSG,
         debug_menu_index::QUICKLOAD,
         debug_menu_index::QUIT_NOSAVE,
@@ -4234,6 +4241,17 @@ void debug()
         }
         break;
 
+        case debug_menu_index::PROFILER_CAPTURE: {
+            const cata_path trace_path = PATH_INFO::config_dir_path() / "profile_trace.json";
+            if( !cata_profiler::capturing() ) {
+                cata_profiler::start_capture( trace_path );
+                add_msg( m_info, _( "Profiler capture started." ) );
+            } else if( cata_profiler::stop_capture() ) {
+                popup( _( "Profiler trace written to %s" ), trace_path.generic_u8string() );
+            }
+        }
+        break;
+
         case debug_menu_index::OM_TELEPORT:
             debug_menu::teleport_overmap();
             break;
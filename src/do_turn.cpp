@@ -56,6 +56,7 @@
 #include "output.h"
 #include "overmap_ui.h"
 #include "overmapbuffer.h"
+#include "perf.h"
 #include "pimpl.h"
 #include "player_activity.h"
 #include "point.h"
@@ -266,6 +267,7 @@ namespace
 {
 void monmove()
 {
+    CATA_PROFILE_ZONE( "monmove", "turn" );
     g->cleanup_dead();
     map &m = get_map();
     avatar &u = get_avatar();
@@ -455,6 +457,7 @@ void overmap_npc_move()
 // Returns true if game is over (death, saved, quit, etc)
 bool do_turn()
 {
+    CATA_PROFILE_ZONE( "do_turn", "turn" );
     if( g->is_game_over() ) {
         return turn_handler::cleanup_at_end();
     }
@@ -6,12 +6,12 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <queue>
 #include <random>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -181,6 +181,86 @@ float gurney_spherical( const double charge, const double mass )
                                          -0.5 ) * TYPICAL_GURNEY_CONSTANT );
 }
 
+namespace
+{
+// Flat storage for the per-tile state of a single blast, covering only the box the
+// blast can possibly reach. Replaces the node-based sets and maps do_blast used before,
+// and iterates tiles in the same x, y, z order as std::set<tripoint_bub_ms> did.
+class blast_grid
+{
+    public:
+        static constexpr uint8_t closed_bit = 1;
+        static constexpr uint8_t bashed_bit = 2;
+
+        blast_grid( const map &m, const tripoint_bub_ms &center, int radius ) {
+            const int map_edge = m.getmapsize() * SEEX - 1;
+            // Every vertical step costs at least three tiles of distance.
+            const int z_radius = radius / 3 + 1;
+            min = tripoint_bub_ms( std::max( 0, center.x() - radius ),
+                                   std::max( 0, center.y() - radius ),
+                                   std::max( -OVERMAP_DEPTH, center.z() - z_radius ) );
+            max = tripoint_bub_ms( std::min( map_edge, center.x() + radius ),
+                                   std::min( map_edge, center.y() + radius ),
+                                   std::min( OVERMAP_HEIGHT, center.z() + z_radius ) );
+            size_x = max.x() - min.x() + 1;
+            size_y = max.y() - min.y() + 1;
+            size_z = max.z() - min.z() + 1;
+            const size_t cells = static_cast<size_t>( size_x ) * size_y * size_z;
+            dist.assign( cells, std::numeric_limits<float>::infinity() );
+            flags.assign( cells, 0 );
+        }
+
+        bool contains( const tripoint_bub_ms &p ) const {
+            return p.x() >= min.x() && p.x() <= max.x() && p.y() >= min.y() && p.y() <= max.y() &&
+                   p.z() >= min.z() && p.z() <= max.z();
+        }
+
+        // Tiles outside the box are never reached, so report them as closed.
+        bool has( const tripoint_bub_ms &p, uint8_t bit ) const {
+            return !contains( p ) || ( flags[index( p )] & bit ) != 0;
+        }
+        void set( const tripoint_bub_ms &p, uint8_t bit ) {
+            flags[index( p )] |= bit;
+        }
+
+        bool has_dist( const tripoint_bub_ms &p ) const {
+            return contains( p ) && dist[index( p )] != std::numeric_limits<float>::infinity();
+        }
+        float &dist_at( const tripoint_bub_ms &p ) {
+            return dist[index( p )];
+        }
+
+        template<typename Fn>
+        void for_each( uint8_t bit, Fn &&fn ) const {
+            for( int x = min.x(); x <= max.x(); x++ ) {
+                for( int y = min.y(); y <= max.y(); y++ ) {
+                    for( int z = min.z(); z <= max.z(); z++ ) {
+                        const tripoint_bub_ms p( x, y, z );
+                        const size_t i = index( p );
+                        if( flags[i] & bit ) {
+                            fn( p, dist[i] );
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        size_t index( const tripoint_bub_ms &p ) const {
+            return ( static_cast<size_t>( p.z() - min.z() ) * size_y + ( p.y() - min.y() ) ) * size_x +
+                   ( p.x() - min.x() );
+        }
+
+        tripoint_bub_ms min;
+        tripoint_bub_ms max;
+        int size_x = 0;
+        int size_y = 0;
+        int size_z = 0;
+        std::vector<float> dist;
+        std::vector<uint8_t> flags;
+};
+} // namespace
+
 // (C1001) Compiler Internal Error on Visual Studio 2015 with Update 2
 static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p, const float power,
                       const float distance_factor, const bool fire )
@@ -201,11 +281,13 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
 
     std::priority_queue< std::pair<float, tripoint_bub_ms>, std::vector< std::pair<float, tripoint_bub_ms> >, pair_greater_cmp_first >
     open;
-    std::set<tripoint_bub_ms> closed;
-    std::set<tripoint_bub_ms> bashed{ p };
-    std::map<tripoint_bub_ms, float> dist_map;
+    // Force drops below 1 once the distance exceeds log( power ) / -log( distance_factor ),
+    // so nothing past that (plus the neighbors of the last expanded tiles) is ever touched.
+    const float max_reach = power > 1.0f ? std::log( power ) / -std::log( distance_factor ) : 0.0f;
+    blast_grid grid( *m, p, static_cast<int>( std::ceil( max_reach ) ) + 2 );
+    grid.set( p, blast_grid::bashed_bit );
     open.emplace( 0.0f, p );
-    dist_map[p] = 0.0f;
+    grid.dist_at( p ) = 0.0f;
     // Find all points to blast
     while( !open.empty() ) {
         // Add some random factor to effective distance to make it look cooler
@@ -213,11 +295,11 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
         const tripoint_bub_ms pt = open.top().second;
         open.pop();
 
-        if( closed.count( pt ) != 0 ) {
+        if( grid.has( pt, blast_grid::closed_bit ) ) {
             continue;
         }
 
-        closed.insert( pt );
+        grid.set( pt, blast_grid::closed_bit );
 
         const float force = power * std::pow( distance_factor, distance );
         if( force <= 1.0f ) {
@@ -234,7 +316,7 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
         int empty_neighbors = 0;
         for( size_t i = 0; i < 8; i++ ) {
             tripoint_bub_ms dest( pt + tripoint_rel_ms( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) == 0 && m->valid_move( pt, dest, false, true ) ) {
+            if( !grid.has( dest, blast_grid::closed_bit ) && m->valid_move( pt, dest, false, true ) ) {
                 empty_neighbors++;
             }
         }
@@ -243,12 +325,12 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
         // Iterate over all neighbors. Bash all of them, propagate to some
         for( size_t i = 0; i < max_index; i++ ) {
             tripoint_bub_ms dest( pt + tripoint_rel_ms( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) != 0 || !m->inbounds( dest ) ) {
+            if( grid.has( dest, blast_grid::closed_bit ) || !m->inbounds( dest ) ) {
                 continue;
             }
 
-            if( bashed.count( dest ) == 0 ) {
-                bashed.insert( dest );
+            if( !grid.has( dest, blast_grid::bashed_bit ) ) {
+                grid.set( dest, blast_grid::bashed_bit );
                 // Up to 200% bonus for shaped charge
                 // But not if the explosion is fiery, then only half the force and no bonus
                 const float bash_force = !fire ?
@@ -277,14 +359,14 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
                 next_dist += zlev_dist;
             }
 
-            if( dist_map.count( dest ) == 0 || dist_map[dest] > next_dist ) {
+            if( !grid.has_dist( dest ) || grid.dist_at( dest ) > next_dist ) {
                 open.emplace( next_dist, dest );
-                dist_map[dest] = next_dist;
+                grid.dist_at( dest ) = next_dist;
             }
         }
     }
 
-    for( const tripoint_bub_ms &pos : bashed ) {
+    grid.for_each( blast_grid::bashed_bit, [m]( const tripoint_bub_ms & pos, float ) {
         const tripoint_bub_ms below = pos + tripoint::below;
         const ter_t ter_below = m->ter( below ).obj();
 
@@ -293,23 +375,23 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
                 m->ter_set( pos, ter_below.roof );
             }
         }
-    }
+    } );
 
     // Draw the explosion, but only if the explosion center is within the reality bubble
     map &bubble_map = reality_bubble();
     if( bubble_map.inbounds( m->get_abs( p ) ) ) {
         std::map<tripoint_bub_ms, nc_color> explosion_colors;
-        for( const tripoint_bub_ms &pt : closed ) {
+        grid.for_each( blast_grid::closed_bit, [&]( const tripoint_bub_ms & pt, float pt_dist ) {
             const tripoint_bub_ms bubble_pos( bubble_map.get_bub( m->get_abs( pt ) ) );
 
             if( !bubble_map.inbounds( bubble_pos ) ) {
-                continue;
+                return;
             }
             if( m->impassable( pt ) ) {
-                continue;
+                return;
             }
 
-            const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+            const float force = power * std::pow( distance_factor, pt_dist );
             nc_color col = c_red;
             if( force < 10 ) {
                 col = c_white;
@@ -318,15 +400,20 @@ static void do_blast( map *m, const Creature *source, const tripoint_bub_ms &p,
             }
 
             explosion_colors[bubble_pos] = col;
-        }
+        } );
 
         draw_custom_explosion( explosion_colors );
     }
 
     creature_tracker &creatures = get_creature_tracker();
     Creature *mutable_source = source == nullptr ? nullptr : creatures.creature_at( source->pos_abs() );
-    for( const tripoint_bub_ms &pt : closed ) {
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+    // Snapshot the blasted tiles, in the same order the old std::set visited them.
+    std::vector<std::pair<tripoint_bub_ms, float>> blasted;
+    grid.for_each( blast_grid::closed_bit, [&blasted]( const tripoint_bub_ms & pt, float pt_dist ) {
+        blasted.emplace_back( pt, pt_dist );
+    } );
+    for( const auto &[pt, pt_dist] : blasted ) {
+        const float force = power * std::pow( distance_factor, pt_dist );
         if( force < 1.0f ) {
             // Too weak to matter
             continue;
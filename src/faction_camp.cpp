@@ -90,6 +90,7 @@
 #include "simple_pathfinding.h"
 #include "skill.h"
 #include "stomach.h"
+#include "submap_view.h"
 #include "string_formatter.h"
 #include "translation.h"
 #include "translations.h"
@@ -3603,10 +3604,11 @@ std::pair<size_t, std::string> basecamp::farm_action( const point_rel_omt &dir,
     const auto e_data = expansions.find( dir );
     const tripoint_abs_omt omt_tgt = e_data->second.pos;
 
-    const auto is_dirtmound = []( const tripoint_omt_ms & pos, tinymap & bay1, tinymap & bay2 ) {
-        return ( bay1.ter( pos ) == ter_t_dirtmound ) && ( !bay2.has_furn( pos ) );
+    const auto is_dirtmound = []( const ter_id & ter, const tripoint_omt_ms & pos,
+    const submap_view & farm_map ) {
+        return ( ter == ter_t_dirtmound ) && ( !farm_map.has_furn( pos ) );
     };
-    const auto is_unplowed = []( const tripoint_omt_ms & pos, tinymap & farm_map ) {
+    const auto is_unplowed = []( const tripoint_omt_ms & pos, const submap_view & farm_map ) {
         const ter_id &farm_ter = farm_map.ter( pos );
         return farm_ter->has_flag( ter_furn_flag::TFLAG_PLOWABLE );
     };
@@ -3618,16 +3620,14 @@ std::pair<size_t, std::string> basecamp::farm_action( const point_rel_omt &dir,
     }
 
     // farm_map is what the area actually looks like
-    smallmap farm_map;
-    farm_map.load( omt_tgt, false );
+    submap_view farm_map;
+    farm_map.load( omt_tgt );
     // farm_json is what the area should look like according to jsons (loaded on demand)
     std::unique_ptr<small_fake_map> farm_json;
-    tripoint_omt_ms mapmin{ 0, 0, omt_tgt.z() };
-    tripoint_omt_ms mapmax{ 2 * SEEX - 1, 2 * SEEY - 1, omt_tgt.z() };
     bool done_planting = false;
     Character &player_character = get_player_character();
     map &here = get_map();
-    for( const tripoint_omt_ms &pos : farm_map.points_in_rectangle( mapmin, mapmax ) ) {
+    for( const tripoint_omt_ms &pos : farm_map.points_on_zlevel() ) {
         if( done_planting ) {
             break;
         }
@@ -3675,7 +3675,7 @@ std::pair<size_t, std::string> basecamp::farm_action( const point_rel_omt &dir,
                     }
                 }
                 // Needs to be plowed to match json
-                if( is_dirtmound( pos, *farm_json, farm_map ) && is_unplowed( pos, farm_map ) ) {
+                if( is_dirtmound( farm_json->ter( pos ), pos, farm_map ) && is_unplowed( pos, farm_map ) ) {
                     plots_cnt += 1;
                     if( comp ) {
                         farm_map.ter_set( pos, ter_t_dirtmound );
@@ -3684,7 +3684,7 @@ std::pair<size_t, std::string> basecamp::farm_action( const point_rel_omt &dir,
                 break;
             }
             case farm_ops::plant:
-                if( is_dirtmound( pos, farm_map, farm_map ) ) {
+                if( is_dirtmound( farm_map.ter( pos ), pos, farm_map ) ) {
                     plots_cnt += 1;
                     if( comp ) {
                         if( seed_inv.empty() ) {
@@ -3713,8 +3713,8 @@ std::pair<size_t, std::string> basecamp::farm_action( const point_rel_omt &dir,
             case farm_ops::harvest:
                 if( farm_map.furn( pos ) == furn_f_plant_harvest ) {
                     // Can't use item_stack::only_item() since there might be fertilizer
-                    map_stack items = farm_map.i_at( pos );
-                    const map_stack::iterator seed = std::find_if( items.begin(), items.end(), []( const item & it ) {
+                    const cata::colony<item> &items = farm_map.i_at( pos );
+                    const auto seed = std::find_if( items.begin(), items.end(), []( const item & it ) {
                         return it.is_seed();
                     } );
                     if( seed != items.end() && farm_valid_seed( *seed ) ) {
@@ -4577,13 +4577,11 @@ bool basecamp::survey_field_return( const mission_id &miss_id )
             }
         }
 
-        tinymap target;
-        target.load( where, false );
+        submap_view target;
+        target.load( where );
         int mismatch_tiles = 0;
-        const tripoint_omt_ms mapmin{ 0, 0, where.z() };
-        const tripoint_omt_ms mapmax = { 2 * SEEX - 1, 2 * SEEY - 1, where.z() };
         const std::unordered_set<ter_str_id> match_terrains = { ter_t_clay, ter_t_dirt, ter_t_dirtmound, ter_t_grass, ter_t_grass_dead, ter_t_grass_golf, ter_t_grass_long, ter_t_grass_tall, ter_t_moss, ter_t_sand };
-        for( const tripoint_omt_ms &p : target.points_in_rectangle( mapmin, mapmax ) ) {
+        for( const tripoint_omt_ms &p : target.points_on_zlevel() ) {
             if( match_terrains.find( target.ter( p ).id() ) == match_terrains.end() ) {
                 mismatch_tiles++;
             }
@@ -360,7 +360,7 @@ class flexbuffer_disk_cache
         }
 
         bool save_to_disk( const std::filesystem::path &lexically_normal_json_source_path,
-                           const std::vector<uint8_t> &flexbuffer_binary ) {
+                           const flexbuffer_storage &flexbuffer_binary ) {
             std::error_code ec;
             std::string json_source_path_string = lexically_normal_json_source_path.u8string();
             std::filesystem::file_time_type mtime = get_file_mtime_millis( lexically_normal_json_source_path,
@@ -454,7 +454,21 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse( std::filesystem::pat
 std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
     std::filesystem::path lexically_normal_json_source_path, size_t offset )
 {
+    std::shared_ptr<parsed_flexbuffer> cached = load_cached( lexically_normal_json_source_path,
+            offset );
+    if( cached ) {
+        return cached;
+    }
+
+    std::shared_ptr<parsed_flexbuffer> parsed = parse_uncached( lexically_normal_json_source_path,
+            offset );
+    store( lexically_normal_json_source_path, parsed );
+    return parsed;
+}
 
+std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::load_cached(
+    const std::filesystem::path &lexically_normal_json_source_path, size_t offset )
+{
     // Is our cache potentially stale?
     if( disk_cache_ ) {
         std::shared_ptr<flexbuffer_mmap_storage> cached_storage = disk_cache_->load_flexbuffer_if_not_stale(
@@ -466,10 +480,15 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
             ( void )ec;
 
             return std::make_shared<file_flexbuffer>( std::move( cached_storage ),
-                    std::move( lexically_normal_json_source_path ), mtime, offset );
+                    std::filesystem::path( lexically_normal_json_source_path ), mtime, offset );
         }
     }
+    return nullptr;
+}
 
+std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_uncached(
+    std::filesystem::path lexically_normal_json_source_path, size_t offset )
+{
     std::string json_source_path_string = lexically_normal_json_source_path.generic_u8string();
     std::optional<std::string> json_file_contents = read_whole_file(
                 lexically_normal_json_source_path );
@@ -481,10 +500,6 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
     const char *json_text = reinterpret_cast<const char *>( json_source.c_str() ) + offset;
     std::vector<uint8_t> fb = parse_json_to_flexbuffer_( json_text, json_source_path_string.c_str() );
 
-    if( disk_cache_ ) {
-        disk_cache_->save_to_disk( lexically_normal_json_source_path, fb );
-    }
-
     auto storage = std::make_shared<flexbuffer_vector_storage>( std::move( fb ) );
 
     std::error_code ec;
@@ -499,6 +514,14 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
             mtime, offset );
 }
 
+void flexbuffer_cache::store( const std::filesystem::path &lexically_normal_json_source_path,
+                              const std::shared_ptr<parsed_flexbuffer> &buffer )
+{
+    if( disk_cache_ && buffer ) {
+        disk_cache_->save_to_disk( lexically_normal_json_source_path, *buffer->get_storage() );
+    }
+}
+
 std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_buffer( std::string buffer )
 {
     std::vector<uint8_t> fb = parse_json_to_flexbuffer_( buffer.c_str(), nullptr );
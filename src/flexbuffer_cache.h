@@ -62,6 +62,17 @@ class flexbuffer_cache
         shared_flexbuffer parse_and_cache( std::filesystem::path lexically_normal_json_source_path,
                                            size_t offset = 0 ) noexcept( false ) ;
 
+        // The steps of parse_and_cache, for callers that parse many files at once.
+        // Returns the flexbuffer cached on disk for the file if it is still up to date, nullptr otherwise.
+        shared_flexbuffer load_cached( const std::filesystem::path &lexically_normal_json_source_path,
+                                       size_t offset = 0 );
+        // Reads and parses the file without touching any cache, safe to call from any thread.
+        static shared_flexbuffer parse_uncached( std::filesystem::path lexically_normal_json_source_path,
+                size_t offset = 0 ) noexcept( false );
+        // Writes a flexbuffer returned by parse_uncached to the disk cache.
+        void store( const std::filesystem::path &lexically_normal_json_source_path,
+                    const shared_flexbuffer &buffer );
+
         static shared_flexbuffer parse_buffer( std::string buffer ) noexcept( false );
 
     private:
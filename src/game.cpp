@@ -170,6 +170,7 @@
 #include "past_achievements_info.h"
 #include "path_info.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "pickup.h"
 #include "player_activity.h"
 #include "popup.h"
@@ -3667,6 +3668,7 @@ spell_events &game::spell_events_subscriber()
 
 bool game::save()
 {
+    CATA_PROFILE_ZONE( "save", "save" );
     std::chrono::seconds time_since_load =
         std::chrono::duration_cast<std::chrono::seconds>(
             std::chrono::steady_clock::now() - time_of_last_load );
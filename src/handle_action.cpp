@@ -77,6 +77,7 @@
 #include "overmap_ui.h"
 #include "panels.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "player_activity.h"
 #include "point.h"
 #include "popup.h"
@@ -3121,6 +3122,7 @@ bool game::do_regular_action( action_id &act, avatar &player_character,
 
 bool game::handle_action()
 {
+    CATA_PROFILE_ZONE( "handle_action", "turn" );
     map &here = get_map();
 
     std::string action;
@@ -1,13 +1,20 @@
 #include "init.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "achievement.h"
@@ -24,6 +31,7 @@
 #include "butchery_requirements.h"
 #include "cata_assert.h"
 #include "cata_scope_helpers.h"
+#include "cata_utility.h"
 #include "character_modifier.h"
 #include "city.h"
 #include "climbing.h"
@@ -51,8 +59,10 @@
 #include "flag.h"
 #include "flexbuffer_json.h"
 #include "gates.h"
+#include "get_version.h"
 #include "global_vars.h"
 #include "harvest.h"
+#include "hash_utils.h"
 #include "help.h"
 #include "input.h"
 #include "item_action.h"
@@ -90,6 +100,7 @@
 #include "overmap.h"
 #include "overmap_connection.h"
 #include "overmap_location.h"
+#include "path_info.h"
 #include "profession.h"
 #include "profession_group.h"
 #include "proficiency.h"
@@ -174,8 +185,95 @@ shared_ptr_fast<std::istream> DynamicDataLoader::get_cached_stream( const std::s
     return cached;
 }
 
+/**
+ * The names other objects of the same type can refer to @p jo by in "copy-from".
+ * This is a best guess, load_deferred only uses it to pick the loading order.
+ */
+static std::vector<std::string> copy_from_names( const JsonObject &jo )
+{
+    std::vector<std::string> names;
+    if( jo.has_string( "abstract" ) ) {
+        names.push_back( jo.get_string( "abstract" ) );
+    }
+    if( jo.has_string( "id" ) ) {
+        names.push_back( jo.get_string( "id" ) );
+    } else if( jo.has_array( "id" ) ) {
+        for( const std::string id : jo.get_array( "id" ) ) {
+            names.push_back( id );
+        }
+    }
+    // Recipes are named after their result
+    if( jo.has_string( "result" ) ) {
+        std::string name = jo.get_string( "result" );
+        if( jo.has_string( "variant" ) ) {
+            name += "_" + jo.get_string( "variant" );
+        }
+        if( jo.has_string( "id_suffix" ) ) {
+            name += "_" + jo.get_string( "id_suffix" );
+        }
+        names.push_back( name );
+    }
+    return names;
+}
+
 void DynamicDataLoader::load_deferred( deferred_json &data )
 {
+    // Build the copy-from forest of the deferred objects, so each object can be loaded
+    // right after the one it copies from in a single pass.
+    // Moved rather than copied, a copy would forget which members were visited already
+    std::vector<std::pair<JsonObject, std::string>> entries(
+                std::make_move_iterator( data.begin() ), std::make_move_iterator( data.end() ) );
+    data.clear();
+    std::unordered_map<std::string, size_t> providers;
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        for( const std::string &name : copy_from_names( entries[i].first ) ) {
+            providers.emplace( name, i );
+        }
+    }
+    std::vector<std::vector<size_t>> children( entries.size() );
+    std::vector<bool> has_parent( entries.size(), false );
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        const JsonObject &jo = entries[i].first;
+        if( !jo.has_string( "copy-from" ) ) {
+            continue;
+        }
+        const auto parent = providers.find( jo.get_string( "copy-from" ) );
+        if( parent != providers.end() && parent->second != i ) {
+            children[parent->second].push_back( i );
+            has_parent[i] = true;
+        }
+    }
+    std::vector<size_t> order;
+    order.reserve( entries.size() );
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        if( !has_parent[i] ) {
+            order.push_back( i );
+        }
+    }
+    for( size_t k = 0; k < order.size(); ++k ) {
+        order.insert( order.end(), children[order[k]].begin(), children[order[k]].end() );
+    }
+    // Whatever was not reached is part of a cycle, leave it for the retry passes below to report.
+    std::vector<bool> reached( entries.size(), false );
+    for( const size_t i : order ) {
+        reached[i] = true;
+    }
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        if( !reached[i] ) {
+            order.push_back( i );
+        }
+    }
+
+    for( const size_t i : order ) {
+        try {
+            load_object( entries[i].first, entries[i].second );
+        } catch( const JsonError &err ) {
+            debugmsg( "(json-error)\n%s", err.what() );
+        }
+        inp_mngr.pump_events();
+    }
+
+    // Objects that are still deferred were either mis-ordered above or cannot be loaded at all.
     while( !data.empty() ) {
         const size_t n = data.size();
         auto it = data.begin();
@@ -191,8 +289,20 @@ void DynamicDataLoader::load_deferred( deferred_json &data )
         }
         data.erase( data.begin(), it );
         if( data.size() == n ) {
+            std::unordered_set<std::string> stuck_names;
+            for( const auto &elem : data ) {
+                for( const std::string &name : copy_from_names( elem.first ) ) {
+                    stuck_names.insert( name );
+                }
+            }
             for( const auto &elem : data ) {
                 try {
+                    const std::string parent = elem.first.has_string( "copy-from" ) ?
+                                               elem.first.get_string( "copy-from" ) : std::string();
+                    if( !parent.empty() && !stuck_names.count( parent ) ) {
+                        elem.first.throw_error_at( "copy-from", string_format(
+                                                       "copy-from target \"%s\" was not found, this object is discarded", parent ) );
+                    }
                     elem.first.throw_error( "JSON contains circular dependency, this object is discarded" );
                 } catch( const JsonError &err ) {
                     debugmsg( "(json-error)\n%s", err.what() );
@@ -488,12 +598,15 @@ void DynamicDataLoader::load_data_from_path( const cata_path &path, const std::s
         files.emplace_back( path );
     }
 
-    // iterate over each file
     for( const cata_path &file : files ) {
+        add_to_fingerprint( file, src );
+    }
+    // parse all files up front, then dispatch them in order
+    std::vector<json_loader::file_result> parsed = json_loader::from_paths( files );
+    for( size_t i = 0; i < files.size(); ++i ) {
         try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file );
-            load_all_from_json( jsin, src, path, file );
+            JsonValue jsin = std::move( parsed[i] ).get();
+            load_all_from_json( jsin, src, path, files[i] );
         } catch( const JsonError &err ) {
             throw std::runtime_error( err.what() );
         }
@@ -521,12 +634,15 @@ void DynamicDataLoader::load_mod_data_from_path( const cata_path &path, const st
         files.emplace_back( path );
     }
 
-    // iterate over each file
     for( const cata_path &file : files ) {
+        add_to_fingerprint( file, src );
+    }
+    // parse all files up front, then dispatch them in order
+    std::vector<json_loader::file_result> parsed = json_loader::from_paths( files );
+    for( size_t i = 0; i < files.size(); ++i ) {
         try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file );
-            load_all_from_json( jsin, src, path, file );
+            JsonValue jsin = std::move( parsed[i] ).get();
+            load_all_from_json( jsin, src, path, files[i] );
         } catch( const JsonError &err ) {
             throw std::runtime_error( err.what() );
         }
@@ -560,11 +676,18 @@ void DynamicDataLoader::load_mod_interaction_files_from_path( const cata_path &p
             }
         }
     }
-    // iterate over each file
+    std::vector<cata_path> file_paths;
+    file_paths.reserve( files.size() );
+    for( const std::pair<const mod_id, cata_path> &file : files ) {
+        file_paths.push_back( file.second );
+        add_to_fingerprint( file.second, string_format( "%s#%s", src, file.first.str() ) );
+    }
+    // parse all files up front, then dispatch them in order
+    std::vector<json_loader::file_result> parsed = json_loader::from_paths( file_paths );
+    size_t i = 0;
     for( const std::pair<const mod_id, cata_path> &file : files ) {
         try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file.second );
+            JsonValue jsin = std::move( parsed[i++] ).get();
             load_all_from_json( jsin, string_format( "%s#%s", src, file.first.str() ), path, file.second );
         } catch( const JsonError &err ) {
             throw std::runtime_error( err.what() );
@@ -572,6 +695,69 @@ void DynamicDataLoader::load_mod_interaction_files_from_path( const cata_path &p
     }
 }
 
+// Identifies the executable, so a rebuild under the same version string (like a "-dirty"
+// one) does not reuse the verification of the previous build.
+static size_t build_fingerprint()
+{
+    size_t fingerprint = 0;
+    cata::hash_combine( fingerprint, std::string( getVersionString() ) );
+    cata::hash_combine( fingerprint, std::string( __DATE__ " " __TIME__ ) );
+#if defined(__linux__)
+    const std::filesystem::path exe( "/proc/self/exe" );
+    std::error_code ec;
+    const std::uintmax_t size = std::filesystem::file_size( exe, ec );
+    if( !ec ) {
+        cata::hash_combine( fingerprint, static_cast<uint64_t>( size ) );
+    }
+    const std::filesystem::file_time_type mtime = std::filesystem::last_write_time( exe, ec );
+    if( !ec ) {
+        cata::hash_combine( fingerprint, static_cast<int64_t>( mtime.time_since_epoch().count() ) );
+    }
+#endif
+    return fingerprint;
+}
+
+void DynamicDataLoader::add_to_fingerprint( const cata_path &file, const std::string &src )
+{
+    if( data_fingerprint == 0 ) {
+        static const size_t build = build_fingerprint();
+        cata::hash_combine( data_fingerprint, build );
+    }
+    std::error_code ec;
+    const std::filesystem::file_time_type mtime = std::filesystem::last_write_time(
+                file.get_unrelative_path(), ec );
+    cata::hash_combine( data_fingerprint, file.generic_u8string() );
+    cata::hash_combine( data_fingerprint, static_cast<int64_t>( mtime.time_since_epoch().count() ) );
+    cata::hash_combine( data_fingerprint, src );
+}
+
+static cata_path verified_data_path()
+{
+    return PATH_INFO::user_dir_path() / "cache" / "verified_data.txt";
+}
+
+bool DynamicDataLoader::data_previously_verified( int64_t &verification_ms ) const
+{
+    bool verified = false;
+    read_from_file_optional( verified_data_path(), [&]( std::istream & fin ) {
+        size_t fingerprint = 0;
+        int64_t ms = 0;
+        if( fin >> fingerprint >> ms && fingerprint == data_fingerprint ) {
+            verified = true;
+            verification_ms = ms;
+        }
+    } );
+    return verified;
+}
+
+void DynamicDataLoader::remember_data_verified( int64_t verification_ms ) const
+{
+    assure_dir_exist( PATH_INFO::user_dir_path() / "cache" );
+    write_to_file( verified_data_path(), [&]( std::ostream & fout ) {
+        fout << data_fingerprint << " " << verification_ms;
+    }, nullptr );
+}
+
 void DynamicDataLoader::load_all_from_json( const JsonValue &jsin, const std::string &src,
         const cata_path &base_path, const cata_path &full_path )
 {
@@ -595,6 +781,7 @@ void DynamicDataLoader::load_all_from_json( const JsonValue &jsin, const std::st
 void DynamicDataLoader::unload_data()
 {
     finalized = false;
+    data_fingerprint = 0;
 
     achievement::reset();
     activity_type::reset();
@@ -717,6 +904,22 @@ void DynamicDataLoader::unload_data()
     zone_type::reset();
 }
 
+using named_entry = std::pair<std::string, std::function<void()>>;
+
+// Runs the steps of a loading phase in order, logging how long each one took so the slow
+// ones can be found.
+static void run_load_steps( const std::string &title, const std::vector<named_entry> &entries )
+{
+    for( const named_entry &e : entries ) {
+        loading_ui::show( title, e.first );
+        const auto start = std::chrono::steady_clock::now();
+        e.second();
+        DebugLog( D_INFO, D_MAIN ) << title << " " << e.first << " took " <<
+                                   std::chrono::duration_cast<std::chrono::milliseconds>(
+                                       std::chrono::steady_clock::now() - start ).count() << " ms";
+    }
+}
+
 // void DynamicDataLoader::finalize_loaded_data()
 // {
 //     // Create a dummy that will not display anything
@@ -735,7 +938,6 @@ void DynamicDataLoader::finalize_loaded_data()
     } );
     stream_cache = std::make_unique<cached_streams>();
 
-    using named_entry = std::pair<std::string, std::function<void()>>;
     const std::vector<named_entry> entries = {{
             { _( "Flags" ), &json_flag::finalize_all },
             { _( "Option sliders" ), &option_slider::finalize_all },
@@ -808,20 +1010,30 @@ void DynamicDataLoader::finalize_loaded_data()
         }
     };
 
-    for( const named_entry &e : entries ) {
-        loading_ui::show( _( "Finalizing" ), e.first );
-        e.second();
-    }
+    run_load_steps( _( "Finalizing" ), entries );
 
-    if( !get_option<bool>( "SKIP_VERIFICATION" ) ) {
+    int64_t verification_ms = 0;
+    if( get_option<bool>( "SKIP_VERIFICATION" ) ) {
+        // Verification skipped entirely
+    } else if( get_option<bool>( "CACHE_VERIFICATION" ) &&
+               data_previously_verified( verification_ms ) ) {
+        DebugLog( D_INFO, D_MAIN ) << "Data unchanged since the last successful verification, "
+                                   << "skipping it (it took " << verification_ms << " ms)";
+    } else {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
         check_consistency();
+        verification_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              std::chrono::steady_clock::now() - start ).count();
+        DebugLog( D_INFO, D_MAIN ) << "Data verification took " << verification_ms << " ms";
+        if( get_option<bool>( "CACHE_VERIFICATION" ) && !debug_has_error_been_observed() ) {
+            remember_data_verified( verification_ms );
+        }
     }
     finalized = true;
 }
 
 void DynamicDataLoader::check_consistency()
 {
-    using named_entry = std::pair<std::string, std::function<void()>>;
     const std::vector<named_entry> entries = {{
             { _( "Flags" ), &json_flag::check_consistency },
             { _( "Option sliders" ), &option_slider::check_consistency },
@@ -908,8 +1120,5 @@ void DynamicDataLoader::check_consistency()
         }
     };
 
-    for( const named_entry &e : entries ) {
-        loading_ui::show( _( "Verifying" ), e.first );
-        e.second();
-    }
+    run_load_steps( _( "Verifying" ), entries );
 }
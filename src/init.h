@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_INIT_H
 #define CATA_SRC_INIT_H
 
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <list>
@@ -69,6 +70,21 @@ class DynamicDataLoader
 
         std::unique_ptr<cached_streams> stream_cache;
 
+        /**
+         * Hash of the build (version string, build time and executable) and of every
+         * data file loaded so far (path, modification time and source mod, in load
+         * order). Identifies the finalized data, see @ref finalize_loaded_data.
+         */
+        size_t data_fingerprint = 0;
+        void add_to_fingerprint( const cata_path &file, const std::string &src );
+        /**
+         * Whether @ref check_consistency passed for data with the current fingerprint before.
+         * If so, sets @p verification_ms to how long it took then.
+         */
+        bool data_previously_verified( int64_t &verification_ms ) const;
+        /** Remembers that the data with the current fingerprint passed @ref check_consistency. */
+        void remember_data_verified( int64_t verification_ms ) const;
+
     protected:
         /**
          * Maps the type string (coming from json) to the
@@ -100,6 +100,8 @@ struct item_name_t {
     std::string sort_key;
     std::string full_name;
     unsigned int contents_count{};
+    // full_name prepared for filtering
+    lc_search_key search_key;
 };
 using name_cache_t = std::unordered_map<item const *, item_name_t>;
 name_cache_t item_name_cache;
@@ -109,10 +111,12 @@ item_name_t &get_cached_name( item const *it )
 {
     auto iter = item_name_cache.find( it );
     if( iter == item_name_cache.end() ) {
+        std::string full_name = remove_color_tags( it->tname( 1, true ) );
+        lc_search_key search_key( full_name );
         return item_name_cache
                .emplace( it, item_name_t{ remove_color_tags( it->tname( 1, tname::tname_sort_key ) ),
-                                          remove_color_tags( it->tname( 1, true ) ),
-                                          it->aggregated_contents().count } )
+                                          std::move( full_name ), it->aggregated_contents().count,
+                                          std::move( search_key ) } )
                .first->second;
     }
 
@@ -144,16 +148,20 @@ using pred_t = std::function<bool( inventory_entry const & )>;
 void move_if( std::vector<inventory_entry> &src, std::vector<inventory_entry> &dst,
               pred_t const &pred )
 {
-    for( auto it = src.begin(); it != src.end(); ) {
+    auto kept = src.begin();
+    for( auto it = src.begin(); it != src.end(); ++it ) {
         if( pred( *it ) ) {
             if( it->is_item() ) {
                 dst.emplace_back( std::move( *it ) );
             }
-            it = src.erase( it );
         } else {
-            ++it;
+            if( kept != it ) {
+                *kept = std::move( *it );
+            }
+            ++kept;
         }
     }
+    src.erase( kept, src.end() );
 }
 
 bool always_yes( const inventory_entry & )
@@ -615,6 +623,7 @@ void inventory_entry::update_cache()
     cached_name = &names.sort_key;
     contents_count = names.contents_count;
     cached_name_full = &names.full_name;
+    cached_search_key = &names.search_key;
 }
 
 void inventory_entry::cache_denial( inventory_selector_preset const &preset ) const
@@ -725,6 +734,15 @@ nc_color inventory_selector_preset::get_color( const inventory_entry &entry ) co
 std::function<bool( const inventory_entry & )> inventory_selector_preset::get_filter(
     const std::string &filter ) const
 {
+    // Plain searches match the item name, which is already cached for the entry
+    if( filter.find( ':' ) == std::string::npos ) {
+        return [query = lc_search_query( filter ), filter]( const inventory_entry & e ) {
+            if( e.cached_search_key != nullptr ) {
+                return lcmatch( *e.cached_search_key, query );
+            }
+            return lcmatch( remove_color_tags( e.any_item()->tname() ), filter );
+        };
+    }
     auto item_filter = basic_item_filter( filter );
 
     return [item_filter]( const inventory_entry & e ) {
@@ -1520,8 +1538,7 @@ void inventory_column::prepare_paging( const std::string &filter )
     move_if( entries, entries_hidden, is_not_visible );
 
     // Then sort them with respect to categories
-    std::stable_sort( entries.begin(), entries.end(),
-    [this]( const inventory_entry & lhs, const inventory_entry & rhs ) {
+    const auto entry_compare = [this]( const inventory_entry & lhs, const inventory_entry & rhs ) {
         if( *lhs.get_category_ptr() == *rhs.get_category_ptr() ) {
             if( _collated ) {
                 return collated_sort_compare( lhs, rhs );
@@ -1533,38 +1550,58 @@ void inventory_column::prepare_paging( const std::string &filter )
             return sort_compare( lhs, rhs );
         }
         return preset.cat_sort_compare( lhs, rhs );
-    } );
+    };
+    // The entries kept from the last paging are usually still in order and the restored or added
+    // ones follow them, so only the out of order tail needs sorting before it is merged in.
+    // This gives the same order as sorting everything.
+    const auto sorted_end = std::is_sorted_until( entries.begin(), entries.end(), entry_compare );
+    if( sorted_end != entries.end() ) {
+        std::stable_sort( sorted_end, entries.end(), entry_compare );
+        std::inplace_merge( entries.begin(), sorted_end, entries.end(), entry_compare );
+    }
 
     if( !_collated && collate_entries() ) {
         collate();
     }
 
     // Recover categories
+    entries_t with_categories;
+    with_categories.reserve( entries.size() );
     const item_category *current_category = nullptr;
-    for( auto iter = entries.begin(); iter != entries.end(); ++iter ) {
-        if( iter->get_category_ptr() == current_category ) {
-            continue;
+    for( inventory_entry &entry : entries ) {
+        if( entry.get_category_ptr() != current_category ) {
+            current_category = entry.get_category_ptr();
+            with_categories.emplace_back( current_category );
         }
-        current_category = iter->get_category_ptr();
-        iter = entries.insert( iter, inventory_entry( current_category ) );
+        with_categories.emplace_back( std::move( entry ) );
     }
+    entries = std::move( with_categories );
     // Determine the new height.
     entries_per_page = height;
-    if( entries.size() > entries_per_page ) {
+    if( entries.size() > entries_per_page && entries_per_page > 1 ) {
         entries_per_page -= 1;  // Make room for the page number.
-        for( size_t i = entries_per_page - 1; i < entries.size(); i += entries_per_page ) {
-            auto iter = std::next( entries.begin(), i );
-            if( iter->is_category() ) {
+        entries_t paged;
+        paged.reserve( entries.size() + 2 * ( entries.size() / entries_per_page + 1 ) );
+        for( auto iter = entries.begin(); iter != entries.end(); ++iter ) {
+            if( ( paged.size() + 1 ) % entries_per_page != 0 ) {
+                paged.emplace_back( std::move( *iter ) );
+            } else if( iter->is_category() ) {
                 // The last item on the page must not be a category.
-                entries.insert( iter, inventory_entry() );
+                paged.emplace_back();
+                paged.emplace_back( std::move( *iter ) );
             } else {
+                paged.emplace_back( std::move( *iter ) );
                 // The first item on the next page must be a category.
-                iter = std::next( iter );
-                if( iter != entries.end() && iter->is_item() ) {
-                    entries.insert( iter, inventory_entry( iter->get_category_ptr() ) );
+                const auto next = std::next( iter );
+                if( next != entries.end() && next->is_item() ) {
+                    paged.emplace_back( next->get_category_ptr() );
                 }
             }
         }
+        entries = std::move( paged );
+    } else if( entries.size() > entries_per_page ) {
+        // A single entry per page leaves no room to keep categories with their items
+        entries_per_page -= 1;
     }
     paging_is_valid = true;
     // Select the uppermost possible entry
@@ -59,6 +59,7 @@ enum class toggle_mode : int {
 };
 
 struct inventory_input;
+struct lc_search_key;
 struct navigation_mode_data;
 
 struct collation_meta_t {
@@ -79,6 +80,7 @@ class inventory_entry
         int custom_invlet = INT_MIN;
         std::string *cached_name = nullptr;
         std::string *cached_name_full = nullptr;
+        const lc_search_key *cached_search_key = nullptr;
         unsigned int contents_count = 0;
         size_t cached_denial_space = 0;
 
@@ -10582,18 +10582,20 @@ bool item::has_relic_activation() const
     return is_relic() && relic_data->has_activation();
 }
 
-std::vector<enchant_cache> item::get_proc_enchantments() const
+const std::vector<enchant_cache> &item::get_proc_enchantments() const
 {
+    static const std::vector<enchant_cache> none;
     if( !is_relic() ) {
-        return std::vector<enchant_cache> {};
+        return none;
     }
     return relic_data->get_proc_enchantments();
 }
 
-std::vector<enchantment> item::get_defined_enchantments() const
+const std::vector<enchantment> &item::get_defined_enchantments() const
 {
+    static const std::vector<enchantment> none;
     if( !is_relic() || !type->relic_data ) {
-        return std::vector<enchantment> {};
+        return none;
     }
 
     return type->relic_data->get_defined_enchantments();
@@ -3055,8 +3055,8 @@ class item : public visitable
         void set_cached_tool_selections( const std::vector<comp_selection<tool_comp>> &selections );
         const std::vector<comp_selection<tool_comp>> &get_cached_tool_selections() const;
 
-        std::vector<enchant_cache> get_proc_enchantments() const;
-        std::vector<enchantment> get_defined_enchantments() const;
+        const std::vector<enchant_cache> &get_proc_enchantments() const;
+        const std::vector<enchantment> &get_defined_enchantments() const;
         // calculates the enchantment value as if this item were wielded.
         double calculate_by_enchantment_wield( const Character &owner, double modify,
                                                enchant_vals::mod value,
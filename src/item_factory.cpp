@@ -1515,6 +1515,12 @@ void Item_factory::finalize()
 
     finalize_item_blacklist();
 
+    for( std::pair<const item_group_id, std::unique_ptr<Item_spawn_data>> &g : m_template_groups ) {
+        if( Item_group *ig = dynamic_cast<Item_group *>( g.second.get() ) ) {
+            ig->finalize();
+        }
+    }
+
     // we can no longer add or adjust static item templates
     frozen = true;
 
@@ -1,6 +1,7 @@
 #include "item_group.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <set>
@@ -282,7 +283,8 @@ std::size_t Single_item_creator::create( ItemList &list,
                       modifier_count.first, modifier_count.second );
         }
     }
-    float spawn_rate = get_option<float>( "ITEM_SPAWNRATE" );
+    const float spawn_rate = flags & spawn_flags::use_spawn_rate ?
+                             get_option<float>( "ITEM_SPAWNRATE" ) : 1.0f;
     for( ; cnt > 0; cnt-- ) {
         if( type == S_ITEM ) {
             item itm = create_single_without_container( birthday, rec );
@@ -811,6 +813,7 @@ void Item_group::add_entry( std::unique_ptr<Item_spawn_data> ptr )
         ptr->set_probablility( std::min( 100, ptr->get_probability( true ) ) );
     }
     sum_prob += ptr->get_probability( true );
+    spawn_tables_valid = false;
 
     // Make the ammo and magazine probabilities from the outer entity apply to the nested entity:
     // If ptr is an Item_group, it already inherited its parent's ammo/magazine chances in its constructor.
@@ -833,17 +836,9 @@ std::size_t Item_group::create( Item_spawn_data::ItemList &list,
             elem->create( list, birthday, rec, flags );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            bool ev_based = elem->is_event_based();
-            int prob = elem->get_probability( false );
-            int real_prob = elem->get_probability( true );
-            p -= real_prob;
-            if( ( ev_based && prob == 0 ) || p >= 0 ) {
-                continue;
-            }
-            elem->create( list, birthday, rec, flags );
-            break;
+        const int picked = pick_entry();
+        if( picked >= 0 ) {
+            items[picked]->create( list, birthday, rec, flags );
         }
     }
     const std::size_t items_created = list.size() - prev_list_size;
@@ -863,21 +858,119 @@ item Item_group::create_single( const time_point &birthday, RecursionList &rec )
             return elem->create_single( birthday, rec );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            bool ev_based = elem->is_event_based();
-            int prob = elem->get_probability( false );
-            int real_prob = elem->get_probability( true );
-            p -= real_prob;
-            if( ( ev_based && prob == 0 ) || p >= 0 ) {
-                continue;
-            }
-            return elem->create_single( birthday, rec );
+        const int picked = pick_entry();
+        if( picked >= 0 ) {
+            return items[picked]->create_single( birthday, rec );
         }
     }
     return item( itype_id::NULL_ID(), birthday );
 }
 
+void Item_group::finalize()
+{
+    for( const std::unique_ptr<Item_spawn_data> &elem : items ) {
+        if( Item_group *nested = dynamic_cast<Item_group *>( elem.get() ) ) {
+            nested->finalize();
+        }
+    }
+    if( type == G_DISTRIBUTION ) {
+        build_spawn_tables();
+    }
+}
+
+void Item_group::build_spawn_tables() const
+{
+    spawn_tables.clear();
+    std::vector<holiday> events = { holiday::none };
+    for( const std::unique_ptr<Item_spawn_data> &elem : items ) {
+        if( elem->is_event_based() &&
+            std::find( events.begin(), events.end(), elem->get_event() ) == events.end() ) {
+            events.push_back( elem->get_event() );
+        }
+    }
+    for( const holiday ev : events ) {
+        spawn_table &table = spawn_tables.emplace_back();
+        table.active_event = ev;
+        // ( entry index or -1 for nothing, weight ) of every possible outcome
+        std::vector<std::pair<int, int>> outcomes;
+        int carried = 0;
+        for( size_t i = 0; i < items.size(); i++ ) {
+            carried += items[i]->get_probability( true );
+            if( !items[i]->is_event_based() || items[i]->get_event() == ev ) {
+                outcomes.emplace_back( static_cast<int>( i ), carried );
+                carried = 0;
+            }
+        }
+        if( carried > 0 ) {
+            outcomes.emplace_back( -1, carried );
+        }
+        for( const std::pair<int, int> &outcome : outcomes ) {
+            table.total += outcome.second;
+        }
+
+        // Vose's alias method on weights scaled by the number of columns, so every column
+        // holds exactly total and the probabilities stay exact in integers.
+        const size_t columns = outcomes.size();
+        table.primary.resize( columns );
+        table.alias.assign( columns, -1 );
+        table.threshold.assign( columns, table.total );
+        std::vector<int64_t> scaled( columns );
+        std::vector<size_t> small;
+        std::vector<size_t> large;
+        for( size_t i = 0; i < columns; i++ ) {
+            table.primary[i] = outcomes[i].first;
+            scaled[i] = static_cast<int64_t>( outcomes[i].second ) * columns;
+            ( scaled[i] < table.total ? small : large ).push_back( i );
+        }
+        while( !small.empty() && !large.empty() ) {
+            const size_t s = small.back();
+            small.pop_back();
+            const size_t l = large.back();
+            table.threshold[s] = static_cast<int>( scaled[s] );
+            table.alias[s] = outcomes[l].first;
+            scaled[l] -= table.total - scaled[s];
+            if( scaled[l] < table.total ) {
+                large.pop_back();
+                small.push_back( l );
+            }
+        }
+    }
+    spawn_tables_valid = true;
+}
+
+int Item_group::spawn_table::pick() const
+{
+    if( primary.empty() ) {
+        return -1;
+    }
+    const int column = rng( 0, static_cast<int>( primary.size() ) - 1 );
+    if( threshold[column] >= total || rng( 0, total - 1 ) < threshold[column] ) {
+        return primary[column];
+    }
+    return alias[column];
+}
+
+int Item_group::pick_entry() const
+{
+    if( !spawn_tables_valid ) {
+        build_spawn_tables();
+    }
+    const spawn_table *table = &spawn_tables.front();
+    if( spawn_tables.size() > 1 ) {
+        const std::string opt = get_option<std::string>( "EVENT_SPAWNS" );
+        if( opt == "items" || opt == "both" ) {
+            const holiday current = get_holiday_from_time();
+            for( const spawn_table &t : spawn_tables ) {
+                if( t.active_event == current ) {
+                    table = &t;
+                    break;
+                }
+            }
+        }
+    }
+    return table->pick();
+}
+
 void Item_group::check_consistency( bool actually_spawn ) const
 {
     // if type is collection, then spawning itself automatically spawnes all entries,
@@ -922,6 +1015,7 @@ bool Item_group::remove_item( const itype_id &itemid )
             ++a;
         }
     }
+    spawn_tables_valid = false;
     if( container_item && ( *container_item == itemid ) ) {
         container_item = std::nullopt;
         on_overflow = overflow_behaviour::none;
@@ -189,6 +189,9 @@ class Item_spawn_data
         bool is_event_based() const {
             return event != holiday::none;
         }
+        holiday get_event() const {
+            return event;
+        }
 
         /**
          * The group spawns contained in this item
@@ -393,6 +396,11 @@ class Item_group : public Item_spawn_data
         bool has_item( const itype_id &itemid ) const override;
         std::set<const itype *> every_item() const override;
         std::map<const itype *, std::pair<int, int>> every_item_min_max() const override;
+        /**
+         * Builds the spawn tables of this group and the groups nested in it. Called once all
+         * item groups are loaded, a group changed afterwards rebuilds them when next used.
+         */
+        void finalize();
 
         /**
          * These aren't directly used. Instead, the values (both with a default value of 0) "trickle down"
@@ -414,6 +422,35 @@ class Item_group : public Item_spawn_data
          * Links to the entries in this group.
          */
         prop_list items;
+
+    private:
+        /**
+         * Picks an entry of a distribution in constant time using the alias method.
+         * The entry weights are resolved for one event: entries of other events are inactive
+         * and, as when walking the entries in order, their weight goes to the next active entry,
+         * or to spawning nothing if there is none after them.
+         */
+        struct spawn_table {
+            // Event whose entries are active, holiday::none if only entries without event are
+            holiday active_event = holiday::none;
+            // Total weight, the size of every column
+            int total = 0;
+            // Per column: the entry picked below the threshold and the one picked otherwise,
+            // -1 for spawning nothing
+            std::vector<int> primary;
+            std::vector<int> alias;
+            std::vector<int> threshold;
+
+            int pick() const;
+        };
+
+        void build_spawn_tables() const;
+        /** Index of the distribution entry to spawn, -1 for none. */
+        int pick_entry() const;
+
+        // Table for every event of an entry, plus holiday::none first
+        mutable std::vector<spawn_table> spawn_tables;
+        mutable bool spawn_tables_valid = false;
 };
 
 #endif // CATA_SRC_ITEM_GROUP_H
@@ -8948,7 +8948,7 @@ std::optional<int> iuse::measure_resonance( Character *p, item *it, const tripoi
         if( !tested_item->get_proc_enchantments().empty() ) {
             // We've found an item with an enchantment. This doesn't guarantee it is an artifact! Prune the list to only items with resonance
             bool is_resonant_artifact = false;
-            for( enchant_cache &maybe_artifact : tested_item->get_proc_enchantments() ) {
+            for( const enchant_cache &maybe_artifact : tested_item->get_proc_enchantments() ) {
                 if( maybe_artifact.get_value_add( enchant_vals::mod::ARTIFACT_RESONANCE ) ) {
                     // Found an artifact with resonance!
                     is_resonant_artifact = true;
@@ -8982,7 +8982,7 @@ std::optional<int> iuse::measure_resonance( Character *p, item *it, const tripoi
     popup( _( "Calculating…" ) );
     int actual_resonance = 0;
     // Add up the resonance of all the enchantments on the selected item to get the item's total resonance
-    for( enchant_cache &this_ench : artifacts.at( choice ).get_item()->get_proc_enchantments() ) {
+    for( const enchant_cache &this_ench : artifacts.at( choice ).get_item()->get_proc_enchantments() ) {
         actual_resonance += this_ench.get_value_add( enchant_vals::mod::ARTIFACT_RESONANCE );
     }
     // Random 15% +- on the detection, no freebies here.
@@ -1,8 +1,18 @@
 #include "json_loader.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <filesystem>
 #include <memory>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
 
 #include "filesystem.h"
 #include "flexbuffer_cache.h"
@@ -150,6 +160,86 @@ JsonValue json_loader::from_path( const cata_path &source_file ) noexcept( false
     return from_path_at_offset( source_file, 0 );
 }
 
+JsonValue json_loader::file_result::get() &&
+{
+    if( error ) {
+        std::rethrow_exception( error );
+    }
+    return std::move( *value );
+}
+
+std::vector<json_loader::file_result> json_loader::from_paths(
+    const std::vector<cata_path> &source_files )
+{
+    std::vector<file_result> results( source_files.size() );
+    std::vector<cata_path> normal_paths( source_files.size() );
+    std::vector<std::shared_ptr<parsed_flexbuffer>> buffers( source_files.size() );
+    std::vector<size_t> to_parse;
+    std::vector<bool> needs_store( source_files.size(), false );
+
+    // Looking up the caches may report stale data and modifies the caches, so it stays
+    // on this thread. Only the parsing itself is handed out to the workers.
+    for( size_t i = 0; i < source_files.size(); ++i ) {
+        try {
+            std::filesystem::path unrelative_path = source_files[i].get_unrelative_path();
+            if( !file_exist( unrelative_path ) ) {
+                throw JsonError( unrelative_path.generic_u8string() + " does not exist." );
+            }
+            normal_paths[i] = source_files[i].lexically_normal();
+            if( normal_paths[i].get_logical_root() != cata_path::root_path::unknown ) {
+                buffers[i] = cache_for_lexically_normal_path( normal_paths[i] ).load_cached(
+                                 normal_paths[i].get_unrelative_path() );
+            }
+            if( !buffers[i] ) {
+                to_parse.push_back( i );
+                needs_store[i] = true;
+            }
+        } catch( ... ) {
+            results[i].error = std::current_exception();
+        }
+    }
+
+    std::atomic<size_t> next{ 0 };
+    const auto parse_remaining = [&]() {
+        for( size_t n = next++; n < to_parse.size(); n = next++ ) {
+            const size_t i = to_parse[n];
+            try {
+                buffers[i] = flexbuffer_cache::parse_uncached( normal_paths[i].get_unrelative_path() );
+            } catch( ... ) {
+                results[i].error = std::current_exception();
+            }
+        }
+    };
+    const size_t num_workers = std::min<size_t>( std::thread::hardware_concurrency(),
+                               to_parse.size() );
+    std::vector<std::thread> workers;
+    for( size_t w = 1; w < num_workers; ++w ) {
+        workers.emplace_back( parse_remaining );
+    }
+    parse_remaining();
+    for( std::thread &worker : workers ) {
+        worker.join();
+    }
+
+    for( size_t i = 0; i < source_files.size(); ++i ) {
+        if( results[i].error ) {
+            continue;
+        }
+        if( !buffers[i] ) {
+            results[i].error = std::make_exception_ptr( JsonError( "Json file " +
+                               source_files[i].get_unrelative_path().generic_u8string() + " did not contain valid json" ) );
+            continue;
+        }
+        if( needs_store[i] && normal_paths[i].get_logical_root() != cata_path::root_path::unknown ) {
+            cache_for_lexically_normal_path( normal_paths[i] ).store( normal_paths[i].get_unrelative_path(),
+                    buffers[i] );
+        }
+        flexbuffers::Reference buffer_root = flexbuffer_root_from_storage( buffers[i]->get_storage() );
+        results[i].value.emplace( std::move( buffers[i] ), buffer_root, nullptr, 0 );
+    }
+    return results;
+}
+
 JsonValue json_loader::from_string( std::string data ) noexcept( false )
 {
     std::shared_ptr<parsed_flexbuffer> buffer = flexbuffer_cache::parse_buffer( std::move( data ) );
@@ -2,6 +2,11 @@
 #ifndef CATA_SRC_JSON_LOADER_H
 #define CATA_SRC_JSON_LOADER_H
 
+#include <exception>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "path_info.h"
 #include "flexbuffer_json.h"
 
@@ -24,6 +29,20 @@ class json_loader
         static JsonValue from_string( std::string data ) noexcept( false );
         static std::optional<JsonValue> from_string_opt( std::string const &data ) noexcept( false );
 
+        // The outcome of loading one file with from_paths.
+        struct file_result {
+            std::optional<JsonValue> value;
+            std::exception_ptr error;
+
+            // Returns the parsed file, or rethrows the error from loading it.
+            JsonValue get() && noexcept( false );
+        };
+
+        // Like json_loader::from_path for each of the given files. Files that are not in the
+        // flexbuffer cache yet are parsed on a pool of worker threads, so the errors are stored
+        // and only thrown by file_result::get, letting callers report them in file order.
+        static std::vector<file_result> from_paths( const std::vector<cata_path> &source_files );
+
 };
 
 #endif // CATA_SRC_JSON_LOADER_H
@@ -24,6 +24,8 @@ struct level_cache {
         level_cache( const level_cache &other ) = default;
 
         std::bitset<MAPSIZE *MAPSIZE> transparency_cache_dirty;
+        // submaps that look different since the pixel minimap last drew them, see map::take_display_dirty
+        std::bitset<MAPSIZE *MAPSIZE> display_dirty;
         bool outside_cache_dirty = false;
         bool floor_cache_dirty = false;
         bool seen_cache_dirty = false;
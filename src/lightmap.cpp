@@ -18,6 +18,7 @@
 #include "cata_utility.h"
 #include "character.h"
 #include "colony.h"
+#include "creature_tracker.h"
 #include "cuboid_rectangle.h"
 #include "debug.h"
 #include "field.h"
@@ -34,6 +35,7 @@
 #include "monster.h"
 #include "mtype.h"
 #include "npc.h"
+#include "perf.h"
 #include "point.h"
 #include "string_formatter.h"
 #include "submap.h"
@@ -442,6 +444,9 @@ void map::build_sunlight_cache( int pzlev )
 
 void map::generate_lightmap( const int zlev )
 {
+    CATA_PROFILE_ZONE( "generate_lightmap", "map" );
+    // Light decides how far creatures see
+    get_creature_tracker().invalidate_visibility_cache();
     level_cache &map_cache = get_cache( zlev );
     auto &lm = map_cache.lm;
     auto &sm = map_cache.sm;
@@ -1,5 +1,7 @@
 #include "magic_enchantment.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -337,6 +339,27 @@ bool enchantment::is_active( const monster &mon ) const
     return false;
 }
 
+template<typename Key>
+static bool any_variable( const std::map<Key, dbl_or_var> &values )
+{
+    return std::any_of( values.begin(), values.end(), []( const std::pair<const Key, dbl_or_var> &v ) {
+        return !v.second.is_constant();
+    } );
+}
+
+bool enchantment::has_variable_values() const
+{
+    return any_variable( values_add ) || any_variable( values_multiply ) ||
+           any_variable( skill_values_add ) || any_variable( skill_values_multiply ) ||
+           any_variable( encumbrance_values_add ) || any_variable( encumbrance_values_multiply ) ||
+           any_variable( damage_values_add ) || any_variable( damage_values_multiply ) ||
+           any_variable( armor_values_add ) || any_variable( armor_values_multiply ) ||
+           any_variable( extra_damage_add ) || any_variable( extra_damage_multiply ) ||
+    std::any_of( special_vision_vector.begin(), special_vision_vector.end(), []( const special_vision & v ) {
+        return !v.range.is_constant();
+    } );
+}
+
 // Returns true if this enchantment is relevant to monsters. Enchantments that are not relevant to monsters are not processed by monsters.
 bool enchantment::is_monster_relevant() const
 {
@@ -193,6 +193,9 @@ class enchantment
 
         bool is_monster_relevant() const;
 
+        // whether any value is evaluated for the character instead of being a constant
+        bool has_variable_values() const;
+
         // this enchantment is active when wielded.
         // shows total conditional values, so only use this when Character is not available
         bool active_wield() const;
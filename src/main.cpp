@@ -9,6 +9,7 @@
 // IWYU pragma: no_include <sys/signal.h>
 #include <algorithm>
 #include <array>
+#include <climits>
 #include <clocale>
 #include <cstdio>
 #include <cstdlib>
@@ -54,6 +55,7 @@
 #include "ordered_static_globals.h"
 #include "output.h"
 #include "path_info.h"
+#include "perf.h"
 #include "rng.h"
 #include "system_locale.h"
 #include "translations.h"
@@ -145,6 +147,7 @@ void exit_handler( int s )
     const int old_timeout = inp_mngr.get_timeout();
     inp_mngr.reset_timeout();
     if( s != 2 || query_yn( _( "Really Quit?  All unsaved changes will be lost." ) ) ) {
+        cata_profiler::stop_capture();
         deinitDebug();
 
         int exit_status = 0;
@@ -344,6 +347,32 @@ cli_opts parse_commandline( int argc, const char **argv )
                     return 1;
                 }
             },
+            {
+                "--profile", "<file>",
+                "Captures a profiler trace of the session to the given file",
+                section_default,
+                1,
+                []( int, const char **params ) -> int {
+                    cata_profiler::start_capture( cata_path( cata_path::root_path::unknown, params[0] ) );
+                    return 1;
+                }
+            },
+            {
+                "--debug-log-flush", "<milliseconds>",
+                "Longest time debug log messages wait to be written to the file, 0 writes each one immediately",
+                section_default,
+                1,
+                []( int, const char **params ) -> int {
+                    char *end = nullptr;
+                    const long interval = std::strtol( params[0], &end, 10 );
+                    if( end == params[0] || *end != '\0' || interval < 0 || interval > INT_MAX )
+                    {
+                        return -1;
+                    }
+                    setDebugLogFlushInterval( static_cast<int>( interval ) );
+                    return 1;
+                }
+            },
             {
                 "--basepath", "<path>",
                 "Base path for all game data subdirectories",
@@ -80,6 +80,7 @@
 #include "overmap.h"
 #include "overmapbuffer.h"
 #include "pathfinding.h"
+#include "perf.h"
 #include "pocket_type.h"
 #include "projectile.h"
 #include "ranged.h"
@@ -268,10 +269,6 @@ map::map( int mapsize, bool zlev ) : my_MAPSIZE( mapsize ), my_HALF_MAPSIZE( map
         grid.resize( static_cast<size_t>( my_MAPSIZE ) * my_MAPSIZE, nullptr );
     }
 
-    for( auto &ptr : pathfinding_caches ) {
-        ptr = std::make_unique<pathfinding_cache>();
-    }
-
     dbg( D_INFO ) << "map::map(): my_MAPSIZE: " << my_MAPSIZE << " z-levels enabled:" << zlevels;
     traplocs.resize( trap::count() );
 }
@@ -295,7 +292,10 @@ static submap null_submap;
 void map::set_transparency_cache_dirty( const int zlev )
 {
     if( inbounds_z( zlev ) ) {
-        get_cache( zlev ).transparency_cache_dirty.set();
+        level_cache &cache = get_cache( zlev );
+        cache.transparency_cache_dirty.set();
+        cache.display_dirty.set();
+        get_creature_tracker().invalidate_visibility_cache();
     }
 }
 
@@ -303,7 +303,10 @@ void map::set_transparency_cache_dirty( const tripoint_bub_ms &p, bool field )
 {
     if( inbounds( p ) ) {
         const tripoint_bub_sm smp = coords::project_to<coords::sm>( p );
-        get_cache( smp.z() ).transparency_cache_dirty.set( smp.x() * MAPSIZE + smp.y() );
+        level_cache &cache = get_cache( smp.z() );
+        cache.transparency_cache_dirty.set( smp.x() * MAPSIZE + smp.y() );
+        cache.display_dirty.set( smp.x() * MAPSIZE + smp.y() );
+        get_creature_tracker().invalidate_visibility_cache();
         if( !field ) {
             get_creature_tracker().invalidate_reachability_cache();
         }
@@ -320,6 +323,7 @@ void map::set_seen_cache_dirty( const tripoint_bub_ms &change_location )
         if( cache.seen_cache[change_location.x()][change_location.y()] != 0.0 ||
             cache.camera_cache[change_location.x()][change_location.y()] != 0.0 ) {
             cache.seen_cache_dirty = true;
+            get_creature_tracker().invalidate_visibility_cache();
         }
     }
 }
@@ -329,9 +333,29 @@ void map::set_seen_cache_dirty( const int zlevel )
     if( inbounds_z( zlevel ) ) {
         level_cache &cache = get_cache( zlevel );
         cache.seen_cache_dirty = true;
+        get_creature_tracker().invalidate_visibility_cache();
+    }
+}
+
+void map::set_display_dirty( const tripoint_bub_ms &p )
+{
+    if( inbounds( p ) ) {
+        const tripoint_bub_sm smp = coords::project_to<coords::sm>( p );
+        get_cache( smp.z() ).display_dirty.set( smp.x() * MAPSIZE + smp.y() );
     }
 }
 
+std::bitset<MAPSIZE *MAPSIZE> map::take_display_dirty( const int zlev )
+{
+    std::bitset<MAPSIZE *MAPSIZE> result;
+    if( inbounds_z( zlev ) ) {
+        level_cache &cache = get_cache( zlev );
+        result = cache.display_dirty;
+        cache.display_dirty.reset();
+    }
+    return result;
+}
+
 void map::set_outside_cache_dirty( const int zlev )
 {
     if( inbounds_z( zlev ) ) {
@@ -653,6 +677,7 @@ void map::on_vehicle_moved( const int smz )
 
 void map::vehmove()
 {
+    CATA_PROFILE_ZONE( "vehmove", "turn" );
     // give vehicles movement points
     VehicleList vehicle_list;
     int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
@@ -707,7 +732,10 @@ void map::vehmove()
         }
         for( vehicle *veh : cache->vehicle_list ) {
             vehs[veh] = true; // force on map vehicles to true
-            veh->get_connected_vehicles( *this, connected_vehs );
+            // The power grid is cached, so this doesn't search the cables every turn.
+            for( const std::pair<vehicle *const, float> &member : veh->get_power_grid( *this ).members ) {
+                connected_vehs.insert( member.first );
+            }
         }
     }
     for( vehicle *connected_veh : connected_vehs ) {
@@ -1769,6 +1797,8 @@ bool map::furn_set( const tripoint_bub_ms &p, const furn_id &new_furniture, cons
     current_submap->set_map_damage( point_sm_ms( l ), 0 );
 
     // Set the dirty flags
+    set_display_dirty( p );
+    get_creature_tracker().invalidate_visibility_cache();
     const furn_t &old_f = old_id.obj();
     const furn_t &new_f = new_target_furniture.obj();
 
@@ -2236,6 +2266,8 @@ bool map::ter_set( const tripoint_bub_ms &p, const ter_id &new_terrain, bool avo
     current_submap->set_map_damage( point_sm_ms( l ), 0 );
 
     // Set the dirty flags
+    set_display_dirty( p );
+    get_creature_tracker().invalidate_visibility_cache();
     const ter_t &old_t = old_id.obj();
     const ter_t &new_t = new_terrain.obj();
 
@@ -5574,6 +5606,7 @@ static void process_vehicle_items( vehicle &cur_veh, int part )
 
 void map::process_items()
 {
+    CATA_PROFILE_ZONE( "process_items", "turn" );
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z();
     for( int gz = minz; gz <= maxz; ++gz ) {
@@ -6756,7 +6789,8 @@ void map::update_visibility_cache( const int zlev )
 
     cata::mdarray<int, point_bub_sm> sm_squares_seen = {};
 
-    auto &visibility_cache = get_cache( zlev ).visibility_cache;
+    level_cache &cache = get_cache( zlev );
+    auto &visibility_cache = cache.visibility_cache;
 
     tripoint_bub_ms p;
     p.z() = zlev;
@@ -6765,6 +6799,9 @@ void map::update_visibility_cache( const int zlev )
     for( x = 0; x < MAPSIZE_X; x++ ) {
         for( y = 0; y < MAPSIZE_Y; y++ ) {
             lit_level ll = apparent_light_at( p, visibility_variables_cache );
+            if( visibility_cache[x][y] != ll ) {
+                cache.display_dirty.set( x / SEEX * MAPSIZE + y / SEEY );
+            }
             visibility_cache[x][y] = ll;
             sm_squares_seen[ x / SEEX ][ y / SEEY ] += ( ll == lit_level::BRIGHT || ll == lit_level::LIT );
         }
@@ -9540,6 +9577,7 @@ void map::do_vehicle_caching( int z )
 
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
+    CATA_PROFILE_ZONE( "build_map_cache", "map" );
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
@@ -10385,20 +10423,26 @@ pathfinding_cache::pathfinding_cache()
 
 pathfinding_cache &map::get_pathfinding_cache( int zlev ) const
 {
-    return *pathfinding_caches[zlev + OVERMAP_DEPTH];
+    // Allocated on first use, maps that never look for paths don't need one
+    std::unique_ptr<pathfinding_cache> &cache = pathfinding_caches[zlev + OVERMAP_DEPTH];
+    if( !cache ) {
+        cache = std::make_unique<pathfinding_cache>();
+    }
+    return *cache;
 }
 
 void map::set_pathfinding_cache_dirty( const int zlev )
 {
-    if( inbounds_z( zlev ) ) {
-        get_pathfinding_cache( zlev ).dirty = true;
+    // A cache that was not allocated yet starts out dirty anyway
+    if( inbounds_z( zlev ) && pathfinding_caches[zlev + OVERMAP_DEPTH] ) {
+        pathfinding_caches[zlev + OVERMAP_DEPTH]->dirty = true;
     }
 }
 
 void map::set_pathfinding_cache_dirty( const tripoint_bub_ms &p )
 {
-    if( inbounds( p ) ) {
-        get_pathfinding_cache( p.z() ).dirty_points.insert( p.xy() );
+    if( inbounds( p ) && pathfinding_caches[p.z() + OVERMAP_DEPTH] ) {
+        pathfinding_caches[p.z() + OVERMAP_DEPTH]->dirty_points.insert( p.xy() );
     }
 }
 
@@ -10423,7 +10467,7 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
 {
     if( !inbounds_z( zlev ) ) {
         debugmsg( "Tried to get pathfinding cache for out of bounds z-level %d", zlev );
-        return *pathfinding_caches[ OVERMAP_DEPTH ];
+        return get_pathfinding_cache( 0 );
     }
     pathfinding_cache &cache = get_pathfinding_cache( zlev );
     if( cache.dirty || !cache.dirty_points.empty() ) {
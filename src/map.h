@@ -422,8 +422,17 @@ class map
         void set_floor_cache_dirty( int zlev );
         void set_pathfinding_cache_dirty( int zlev );
         void set_pathfinding_cache_dirty( const tripoint_bub_ms &p );
+        // marks the submap of p as changed in looks, see take_display_dirty
+        void set_display_dirty( const tripoint_bub_ms &p );
         /*@}*/
 
+        /**
+         * Returns which submaps of the z-level changed their terrain, furniture, vehicles or
+         * visibility since the last call, indexed like level_cache::transparency_cache_dirty,
+         * and clears them. Used by the pixel minimap to only recolor what changed.
+         */
+        std::bitset<MAPSIZE *MAPSIZE> take_display_dirty( int zlev );
+
         void invalidate_map_cache( int zlev );
 
         // @returns true if map memory decoration should be re/memorized
@@ -51,6 +51,7 @@
 #include "mtype.h"
 #include "npc.h"
 #include "overmapbuffer.h"
+#include "perf.h"
 #include "point.h"
 #include "rng.h"
 #include "scent_block.h"
@@ -163,6 +164,7 @@ int map::burn_body_part( Character &you, field_entry &cur, const bodypart_id &bp
 
 void map::process_fields()
 {
+    CATA_PROFILE_ZONE( "process_fields", "turn" );
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
         auto &field_cache = get_cache( z ).field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
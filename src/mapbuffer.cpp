@@ -26,6 +26,7 @@
 #include "output.h"
 #include "overmapbuffer.h"
 #include "path_info.h"
+#include "perf.h"
 #include "point.h"
 #include "popup.h"
 #include "std_hash_fs_path.h"
@@ -181,6 +182,7 @@ bool mapbuffer::submap_exists_approx( const tripoint_abs_sm &p )
 
 void mapbuffer::save( bool delete_after_save )
 {
+    CATA_PROFILE_ZONE( "mapbuffer::save", "save" );
     assure_dir_exist( PATH_INFO::world_base_save_path() / "maps" );
 
     int num_saved_submaps = 0;
@@ -78,6 +78,7 @@
 #include "output.h"
 #include "overmap.h"
 #include "overmapbuffer.h"
+#include "perf.h"
 #include "pocket_type.h"
 #include "point.h"
 #include "regional_settings.h"
@@ -692,6 +693,7 @@ static void GENERATOR_riot_damage( map &md, const tripoint_abs_omt &p, bool is_a
 void map::generate( const tripoint_abs_omt &p, const time_point &when, bool save_results,
                     bool run_post_process )
 {
+    CATA_PROFILE_ZONE( "map::generate", "mapgen" );
     dbg( D_INFO ) << "map::generate( g[" << g.get() << "], p[" << p << "], "
                   "when[" << to_string( when ) << "] )";
 
@@ -5417,10 +5419,44 @@ void update_mapgen::add( std::unique_ptr<update_mapgen_function_json> &&p )
     funcs_.push_back( std::move( p ) );
 }
 
+static bool is_fixed( const jmapgen_int &i )
+{
+    return i.val == i.valmax;
+}
+
+jmapgen_objects::compiled_obj::compiled_obj( const jmapgen_place &where,
+        const jmapgen_piece &what )
+    : where( where )
+    , what( &what )
+    , fixed_repeat( is_fixed( where.repeat ) && is_fixed( what.repeat ) ?
+                    std::max( where.repeat.val, what.repeat.val ) : 0 )
+    , is_vehicle( typeid( what ) == typeid( jmapgen_vehicle ) )
+    , collision_uses_rng( !is_fixed( where.x ) || !is_fixed( where.y ) || !is_fixed( where.z ) ||
+                          typeid( what ) == typeid( jmapgen_nested ) )
+{
+}
+
 void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
     objects.shrink_to_fit();
+
+    compiled.clear();
+    compiled.reserve( objects.size() );
+    for( const jmapgen_obj &obj : objects ) {
+        compiled.emplace_back( obj.first, *obj.second );
+    }
+    collision_rng_end = 0;
+    for( size_t i = 0; i < compiled.size(); i++ ) {
+        if( compiled[i].collision_uses_rng ) {
+            collision_rng_end = i + 1;
+        }
+    }
+    for( mapgen_phase phase : all_enum_values<mapgen_phase>() ) {
+        phase_start[static_cast<size_t>( phase )] =
+            std::lower_bound( objects.begin(), objects.end(), phase, compare_phases ) - objects.begin();
+    }
+    phase_start.back() = objects.size();
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -5871,7 +5907,7 @@ static ret_val<void> apply_mapgen_in_phases(
     const jmapgen_objects &objects, const tripoint_rel_ms &offset, const std::string &context,
     bool verify = false )
 {
-    const ret_val<void> has_vehicle_collision = objects.has_vehicle_collision( md, offset );
+    const ret_val<void> has_vehicle_collision = objects.has_vehicle_collision( md, offset, verify );
     if( verify &&  !has_vehicle_collision.success() ) {
 
         return has_vehicle_collision;
@@ -6021,17 +6057,17 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
 {
     bool terrain_resolved = false;
 
-    auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
-
-    for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
-        const jmapgen_obj &obj = *it;
-        jmapgen_place where = obj.first;
+    const size_t first = phase_start[static_cast<size_t>( phase )];
+    const size_t last = phase_start[static_cast<size_t>( phase ) + 1];
+    for( size_t i = first; i < last; i++ ) {
+        const compiled_obj &obj = compiled[i];
+        jmapgen_place where = obj.where;
         where.offset( tripoint_rel_ms( -offset.raw() ) );
-        const jmapgen_piece &what = *obj.second;
+        const jmapgen_piece &what = *obj.what;
 
         cata_assert( what.phase() == phase );
 
-        if( !terrain_resolved && typeid( what ) == typeid( jmapgen_vehicle ) ) {
+        if( !terrain_resolved && obj.is_vehicle ) {
             // In order to determine collisions between vehicles and local "terrain" the terrain has to be resolved
             // This code is based on two assumptions:
             // 1. The terrain part of a definition is always placed first.
@@ -6042,7 +6078,8 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
 
         // The user will only specify repeat once in JSON, but it may get loaded both
         // into the what and where in some cases--we just need the greater value of the two.
-        const int repeat = std::max( where.repeat.get(), what.repeat.get() );
+        const int repeat = obj.fixed_repeat > 0 ? obj.fixed_repeat :
+                           std::max( where.repeat.get(), what.repeat.get() );
         for( int i = 0; i < repeat; i++ ) {
             what.apply( dat, where.x, where.y, where.z, context );
         }
@@ -6050,12 +6087,14 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
 }
 
 ret_val<void> jmapgen_objects::has_vehicle_collision( const mapgendata &dat,
-        const tripoint_rel_ms &offset ) const
+        const tripoint_rel_ms &offset, bool result_used ) const
 {
-    for( const jmapgen_obj &obj : objects ) {
-        jmapgen_place where = obj.first;
+    // The checks after the last one that rolls dice only matter for the result
+    const size_t end = result_used ? compiled.size() : collision_rng_end;
+    for( size_t i = 0; i < end; i++ ) {
+        jmapgen_place where = compiled[i].where;
         where.offset( tripoint_rel_ms( - offset.raw() ) );
-        const auto &what = *obj.second;
+        const jmapgen_piece &what = *compiled[i].what;
         const ret_val<void> has_vehicle_collision = what.has_vehicle_collision( dat,
                 tripoint_rel_ms( where.x.get(),
                                  where.y.get(),
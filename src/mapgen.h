@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_MAPGEN_H
 #define CATA_SRC_MAPGEN_H
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -411,9 +412,11 @@ struct jmapgen_objects {
 
         /**
          * checks if applying these objects to data would cause cause a collision with vehicles
-         * on the same map
+         * on the same map. When @p result_used is false, only the checks that draw random numbers
+         * are made, so the random state ends up as if all of them were.
          **/
-        ret_val<void> has_vehicle_collision( const mapgendata &dat, const tripoint_rel_ms &offset ) const;
+        ret_val<void> has_vehicle_collision( const mapgendata &dat, const tripoint_rel_ms &offset,
+                                             bool result_used = true ) const;
 
     private:
         /**
@@ -421,6 +424,27 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+
+        /**
+         * An entry of objects with what can be worked out before generating anything.
+         * Built by finalize, in phase order.
+         */
+        struct compiled_obj {
+            compiled_obj( const jmapgen_place &where, const jmapgen_piece &what );
+
+            jmapgen_place where;
+            const jmapgen_piece *what;
+            // Times to apply the piece when neither repeat is a range, 0 when it must be rolled
+            int fixed_repeat;
+            bool is_vehicle;
+            // Whether checking it for vehicle collisions draws random numbers
+            bool collision_uses_rng;
+        };
+        std::vector<compiled_obj> compiled;
+        // The objects of phase p are compiled[phase_start[p]] up to compiled[phase_start[p + 1]]
+        std::array<size_t, static_cast<size_t>( mapgen_phase::last ) + 1> phase_start = {};
+        // One past the last object whose vehicle collision check draws random numbers
+        size_t collision_rng_end = 0;
         tripoint_rel_ms m_offset;
         point_rel_ms mapgensize;
         point_rel_ms total_size;
@@ -454,11 +454,273 @@ void func_diag::assign( dialogue &d, double val ) const
     throw math::internal_error( "math called assign() on unexpected function that cannot assign" );
 }
 
+/**
+ * Flat stack code compiled from the tree of a math_exp.
+ *
+ * Operators, ternaries, variables and math functions become instructions working on a stack
+ * of doubles, with constant subexpressions folded at compile time. Everything else (dialogue
+ * functions, tripoint members, ...) is evaluated by calling its tree node.
+ */
+class math_program
+{
+    public:
+        void compile( thingie const &tree );
+        double eval( const_dialogue const &d ) const;
+
+    private:
+        struct instr {
+            enum class kind : int {
+                constant = 0,
+                binary,
+                variable,
+                function,
+                jmath_function,
+                node,
+                jump_if_false,
+                jump,
+            };
+            kind k = kind::constant;
+            double val = 0;
+            binary_op::f_t bin = nullptr;
+            math_func::f_t f = nullptr;
+            var const *variable = nullptr;
+            func_jmath const *jmath = nullptr;
+            thingie const *node = nullptr;
+            // number of arguments for functions, target instruction for jumps
+            size_t arg = 0;
+        };
+
+        void emit( thingie const &t );
+        void emit_constant( double val );
+        bool is_constant( size_t first ) const;
+
+        std::vector<instr> code;
+        size_t max_depth = 0;
+};
+
+void math_program::compile( thingie const &tree )
+{
+    code.clear();
+    emit( tree );
+    // Both branches of a ternary are counted here, so this is an upper bound
+    size_t depth = 0;
+    max_depth = 0;
+    for( const instr &i : code ) {
+        switch( i.k ) {
+            case instr::kind::binary:
+            case instr::kind::jump_if_false:
+                depth--;
+                break;
+            case instr::kind::function:
+            case instr::kind::jmath_function:
+                depth = depth - i.arg + 1;
+                break;
+            case instr::kind::jump:
+                break;
+            default:
+                depth++;
+                break;
+        }
+        max_depth = std::max( max_depth, depth );
+    }
+}
+
+void math_program::emit_constant( double val )
+{
+    instr i;
+    i.k = instr::kind::constant;
+    i.val = val;
+    code.push_back( i );
+}
+
+// Whether everything emitted from first on is a single constant per operand
+bool math_program::is_constant( size_t first ) const
+{
+    return std::all_of( code.begin() + first, code.end(), []( const instr & i ) {
+        return i.k == instr::kind::constant;
+    } );
+}
+
+void math_program::emit( thingie const &t )
+{
+    std::visit( overloaded{
+        [this]( double v )
+        {
+            emit_constant( v );
+        },
+        [this]( oper const & v )
+        {
+            const size_t first = code.size();
+            emit( *v.l );
+            emit( *v.r );
+            if( is_constant( first ) && code.size() - first == 2 ) {
+                const double folded = v.op( code[first].val, code[first + 1].val );
+                code.resize( first );
+                emit_constant( folded );
+                return;
+            }
+            instr i;
+            i.k = instr::kind::binary;
+            i.bin = v.op;
+            code.push_back( i );
+        },
+        [this]( ternary const & v )
+        {
+            const size_t first = code.size();
+            emit( *v.cond );
+            if( is_constant( first ) && code.size() - first == 1 ) {
+                const bool cond = code[first].val > 0;
+                code.resize( first );
+                emit( cond ? *v.mhs : *v.rhs );
+                return;
+            }
+            const size_t jump_to_rhs = code.size();
+            code.emplace_back();
+            code.back().k = instr::kind::jump_if_false;
+            emit( *v.mhs );
+            const size_t jump_to_end = code.size();
+            code.emplace_back();
+            code.back().k = instr::kind::jump;
+            code[jump_to_rhs].arg = code.size();
+            emit( *v.rhs );
+            code[jump_to_end].arg = code.size();
+        },
+        [this]( var const & v )
+        {
+            instr i;
+            i.k = instr::kind::variable;
+            i.variable = &v;
+            code.push_back( i );
+        },
+        [this]( func const & v )
+        {
+            const size_t first = code.size();
+            for( thingie const &param : v.params ) {
+                emit( param );
+            }
+            const auto it = std::find_if( functions.begin(), functions.end(), [&v]( math_func const & mf ) {
+                return mf.f == v.f;
+            } );
+            if( it != functions.end() && it->pure && is_constant( first ) &&
+                code.size() - first == v.params.size() ) {
+                std::vector<double> params;
+                params.reserve( v.params.size() );
+                for( size_t i = first; i < code.size(); i++ ) {
+                    params.push_back( code[i].val );
+                }
+                code.resize( first );
+                emit_constant( v.f( params ) );
+                return;
+            }
+            instr i;
+            i.k = instr::kind::function;
+            i.f = v.f;
+            i.arg = v.params.size();
+            code.push_back( i );
+        },
+        [this]( func_jmath const & v )
+        {
+            for( thingie const &param : v.params ) {
+                emit( param );
+            }
+            instr i;
+            i.k = instr::kind::jmath_function;
+            i.jmath = &v;
+            i.arg = v.params.size();
+            code.push_back( i );
+        },
+        [this, &t]( auto const & /* v */ )
+        {
+            instr i;
+            i.k = instr::kind::node;
+            i.node = &t;
+            code.push_back( i );
+        },
+    },
+    t.data );
+}
+
+double math_program::eval( const_dialogue const &d ) const
+{
+    std::array<double, 16> local_stack;
+    std::vector<double> heap_stack;
+    double *stack = local_stack.data();
+    if( max_depth > local_stack.size() ) {
+        heap_stack.resize( max_depth );
+        stack = heap_stack.data();
+    }
+    size_t top = 0;
+    for( size_t pc = 0; pc < code.size(); pc++ ) {
+        instr const &i = code[pc];
+        switch( i.k ) {
+            case instr::kind::constant:
+                stack[top++] = i.val;
+                break;
+            case instr::kind::binary:
+                top--;
+                stack[top - 1] = i.bin( stack[top - 1], stack[top] );
+                break;
+            case instr::kind::variable:
+                stack[top++] = i.variable->eval( d );
+                break;
+            case instr::kind::function: {
+                std::vector<double> const params( stack + top - i.arg, stack + top );
+                top -= i.arg;
+                stack[top++] = i.f( params );
+                break;
+            }
+            case instr::kind::jmath_function: {
+                std::vector<double> const params( stack + top - i.arg, stack + top );
+                top -= i.arg;
+                stack[top++] = i.jmath->id->eval( d, params );
+                break;
+            }
+            case instr::kind::node:
+                stack[top++] = i.node->eval( d );
+                break;
+            case instr::kind::jump_if_false:
+                top--;
+                if( !( stack[top] > 0 ) ) {
+                    pc = i.arg - 1;
+                }
+                break;
+            case instr::kind::jump:
+                pc = i.arg - 1;
+                break;
+        }
+    }
+    return top > 0 ? stack[top - 1] : 0.0;
+}
+
 class math_exp::math_exp_impl
 {
     public:
-        math_exp_impl() = default;
-        explicit math_exp_impl( thingie &&t ): tree( t ) {}
+        math_exp_impl() {
+            program.compile( tree );
+        }
+        explicit math_exp_impl( thingie &&t ): tree( t ) {
+            program.compile( tree );
+        }
+        // The program points into the tree, so it is compiled again for the new copy
+        math_exp_impl( math_exp_impl const &other ) : tree( other.tree ), type( other.type ) {
+            program.compile( tree );
+        }
+        math_exp_impl( math_exp_impl &&other ) : tree( std::move( other.tree ) ), type( other.type ) {
+            program.compile( tree );
+        }
+        math_exp_impl &operator=( math_exp_impl const &other ) {
+            tree = other.tree;
+            type = other.type;
+            program.compile( tree );
+            return *this;
+        }
+        math_exp_impl &operator=( math_exp_impl &&other ) {
+            tree = std::move( other.tree );
+            type = other.type;
+            program.compile( tree );
+            return *this;
+        }
+        ~math_exp_impl() = default;
 
         bool parse( std::string_view str, bool handle_errors ) {
             if( str.empty() ) {
@@ -473,18 +735,23 @@ class math_exp::math_exp_impl
                     output = {};
                     arity = {};
                     tree = thingie { 0.0 };
+                    program.compile( tree );
                     return false;
                 }
 
                 throw math::exception( error( str, ex.what() ) );
             }
+            program.compile( tree );
             return true;
         }
         double eval( const_dialogue const &d ) const {
-            return tree.eval( d );
+            return program.eval( d );
         }
         double eval( dialogue &d ) const {
-            return tree.eval( d );
+            if( std::holds_alternative<ass_oper>( tree.data ) ) {
+                return tree.eval( d );
+            }
+            return program.eval( d );
         }
 
         math_type_t get_type() const {
@@ -522,6 +789,7 @@ class math_exp::math_exp_impl
         };
         std::stack<arity_t> arity;
         thingie tree{ 0.0 };
+        math_program program;
         std::string_view parse_position;
         parse_state state;
         math_type_t type = math_type_t::ret;
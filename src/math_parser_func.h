@@ -19,6 +19,8 @@ struct math_func {
     int num_params;
     using f_t = double ( * )( std::vector<double> const & );
     f_t f;
+    // Result only depends on the arguments, so calls with constant arguments can be folded
+    bool pure = true;
 };
 using pmath_func = math_func const *;
 
@@ -142,13 +144,13 @@ constexpr std::array<math_func, 20> functions{
     math_func{ "abs", 1, abs },
     math_func{ "max", -1, max },
     math_func{ "min", -1, min },
-    math_func{ "clamp", 3, clamp },
+    math_func{ "clamp", 3, clamp, false },
     math_func{ "floor", 1, floor },
     math_func{ "trunc", 1, trunc },
     math_func{ "ceil", 1, ceil },
     math_func{ "round", 1, round },
-    math_func{ "rng", 2, math_rng },
-    math_func{ "rand", 1, rand },
+    math_func{ "rng", 2, math_rng, false },
+    math_func{ "rand", 1, rand, false },
     math_func{ "sqrt", 1, sqrt },
     math_func{ "log", 1, log },
     math_func{ "sin", 1, sin },
@@ -507,7 +507,9 @@ void monster::plan()
         }
         anger_cub_threatened( mon_plan );
     } else if( friendly != 0 && !mon_plan.docile ) {
-        for( monster &tmp : g->all_monsters() ) {
+        // Targets must be seen, so only monsters within view distance are looked at
+        get_creature_tracker().for_each_monster_near( pos_abs(), MAX_VIEW_DISTANCE,
+        [this, &seen_levels, &mon_plan]( monster & tmp ) {
             if( tmp.friendly == 0 && tmp.attitude_to( *this ) == Attitude::HOSTILE &&
                 seen_levels.test( tmp.posz() + OVERMAP_DEPTH ) ) {
                 float rating = rate_target( tmp, mon_plan.dist, mon_plan.smart_planning );
@@ -516,7 +518,7 @@ void monster::plan()
                     mon_plan.dist = rating;
                 }
             }
-        }
+        } );
     }
 
     if( mon_plan.docile ) {
@@ -371,6 +371,7 @@ void monster::poly( const mtype_id &id )
         generate_inventory();
     }
     type = &id.obj();
+    get_creature_tracker().invalidate_visibility_cache();
     moves = 0;
     Creature::set_speed_base( type->speed );
     anger = type->agro;
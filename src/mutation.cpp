@@ -11,6 +11,7 @@
 
 #include "avatar_action.h"
 #include "bionics.h"
+#include "cata_scope_helpers.h"
 #include "cata_utility.h"
 #include "character.h"
 #include "color.h"
@@ -153,48 +154,12 @@ bool Character::has_trait_variant( const trait_and_var &test ) const
 
 bool Character::has_trait_flag( const json_character_flag &b ) const
 {
-    auto iter = trait_flag_cache.find( b );
-    if( iter != trait_flag_cache.end() ) {
-        return iter->second;
-    }
-
-    for( const trait_id &mut : get_functioning_mutations() ) {
-        const mutation_branch &mut_data = mut.obj();
-        if( mut_data.flags.count( b ) > 0 ) {
-            trait_flag_cache[b] = true;
-            return true;
-        } else if( mut_data.activated ) {
-            Character &player = get_player_character();
-            if( ( mut_data.active_flags.count( b ) > 0 && player.has_active_mutation( mut ) ) ||
-                ( mut_data.inactive_flags.count( b ) > 0 && !player.has_active_mutation( mut ) ) ) {
-                trait_flag_cache[b] = true;
-                return true;
-            }
-        }
-    }
-
-    trait_flag_cache[b] = false;
-    return false;
+    return indexed_flag_count( character_flag_index::source::trait, b ) > 0;
 }
 
 int Character::count_trait_flag( const json_character_flag &b ) const
 {
-    int ret = 0;
-    // UGLY, SLOW, should be cached as my_mutation_flags or something
-    for( const trait_id &mut : get_functioning_mutations() ) {
-        const mutation_branch &mut_data = mut.obj();
-        if( mut_data.flags.count( b ) > 0 ) {
-            ret++;
-        } else if( mut_data.activated ) {
-            Character &player = get_player_character();
-            if( ( mut_data.active_flags.count( b ) > 0 && player.has_active_mutation( mut ) ) ||
-                ( mut_data.inactive_flags.count( b ) > 0 && !player.has_active_mutation( mut ) ) ) {
-                ret++;
-            }
-        }
-    }
-
-    return ret;
+    return indexed_flag_count( character_flag_index::source::trait, b );
 }
 
 bool Character::has_base_trait( const trait_id &b ) const
@@ -358,7 +323,7 @@ void Character::set_mut_variant( const trait_id &trait, const mutation_variant *
         if( my_mutations.count( trait ) ) {
             my_mutations[trait].variant = variant;
         }
-        trait_flag_cache.clear();
+        flag_index.invalidate( character_flag_index::source::trait );
     }
 }
 
@@ -405,7 +370,7 @@ void Character::switch_mutations( const trait_id &switched, const trait_id &targ
     if( has_trait( target ) ) {
         cached_mutations[target].powered = start_powered;
     }
-    trait_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::trait );
 }
 
 bool Character::can_power_mutation( const trait_id &mut ) const
@@ -576,7 +541,7 @@ void Character::mutation_effect( const trait_id &mut, const bool worn_destroyed_
     if( mut == trait_GLASSJAW ) {
         recalc_hp();
     }
-    trait_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::trait );
     recalculate_size();
 
     const mutation_branch &branch = mut.obj();
@@ -661,7 +626,7 @@ void Character::mutation_loss_effect( const trait_id &mut )
     if( mut == trait_GLASSJAW ) {
         recalc_hp();
     }
-    trait_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::trait );
     recalculate_size();
 
     const mutation_branch &branch = mut.obj();
@@ -711,7 +676,7 @@ void Character::set_cost_timer( const trait_id &mut, time_duration set )
     const auto all_iter = std::find( all_mut.begin(), all_mut.end(), mut );
     if( iter != cached_mutations.end() ) {
         iter->second.charge = set;
-        trait_flag_cache.clear();
+        flag_index.invalidate( character_flag_index::source::trait );
     } else if( all_iter == all_mut.end() ) {
         // don't have the mutation and don't have it from an item
         debugmsg( "Tried to set cost timer of %s but doesn't have this mutation.", mut.c_str() );
@@ -834,7 +799,10 @@ void Character::activate_cached_mutation( const trait_id &mut )
         return;
     }
 
-    trait_flag_cache.clear();
+    // Any of the paths below may switch the mutation on or off
+    on_out_of_scope invalidate_trait_flags( [this]() {
+        flag_index.invalidate( character_flag_index::source::trait );
+    } );
     if( tdata.powered && tdata.charge > 0_turns ) {
         // Already-on units just lose a bit of charge
         tdata.charge -= 1_turns;
@@ -1005,7 +973,7 @@ void Character::activate_cached_mutation( const trait_id &mut )
 void Character::deactivate_mutation( const trait_id &mut )
 {
     cached_mutations[mut].powered = false;
-    trait_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::trait );
 
     recalc_sight_limits();
     const mutation_branch &mdata = mut.obj();
@@ -1019,7 +1019,7 @@ void Character::initialize( bool learn_recipes )
             cached_mutations[mut].powered = true;
         }
     }
-    trait_flag_cache.clear();
+    flag_index.invalidate( character_flag_index::source::trait );
 
     // Ensure that persistent morale effects (e.g. Optimist) are present at the start.
     apply_persistent_morale();
@@ -5495,4 +5495,6 @@ void npc::set_movement_mode( const move_mode_id &new_mode )
     // Enchantments based on move modes can stack inappropriately without a recalc here
     recalculate_enchantment_cache();
     move_mode = new_mode;
+    // crouching affects visibility
+    get_creature_tracker().invalidate_visibility_cache();
 }
@@ -2887,6 +2887,11 @@ void options_manager::add_options_debug()
          false
 #endif
        );
+
+    add( "CACHE_VERIFICATION", "debug", to_translation( "Remember successful verification" ),
+         to_translation( "If enabled, the JSON verification step is skipped when the game version, the mod list and the data files are the same as the last time it passed.  Data that fails verification is always checked again." ),
+         false
+       );
 }
 
 void options_manager::add_options_android()
@@ -36,6 +36,7 @@
 #include "overmap_connection.h"
 #include "overmap_types.h"
 #include "path_info.h"
+#include "perf.h"
 #include "point.h"
 #include "rng.h"
 #include "simple_pathfinding.h"
@@ -231,6 +232,7 @@ void overmapbuffer::fix_npcs( overmap &new_overmap )
 
 void overmapbuffer::save()
 {
+    CATA_PROFILE_ZONE( "overmapbuffer::save", "save" );
     for( auto &omp : overmaps ) {
         // Note: this may throw io errors from std::ofstream
         omp.second->save();
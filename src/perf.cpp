@@ -1,5 +1,16 @@
 #include "perf.h"
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <ostream>
+
+#include "cata_path.h"
+#include "cata_utility.h"
+#include "json.h"
+#include "translations.h"
+
 cata_timer::timers_map &cata_timer::top_level_timer_map()
 {
     static cata_timer::timers_map map;
@@ -11,3 +22,156 @@ std::vector<cata_timer::timers_map::iterator> &cata_timer::timer_stack()
     static std::vector<cata_timer::timers_map::iterator> stack;
     return stack;
 }
+
+namespace cata_profiler
+{
+namespace
+{
+
+struct event {
+    const zone *z;
+    int64_t start_ns;
+    int64_t end_ns;
+};
+
+// Events kept per thread, older ones are overwritten once a thread has recorded this many
+constexpr int64_t buffer_capacity = 1 << 16;
+constexpr int max_threads = 64;
+
+struct thread_buffer {
+    explicit thread_buffer( int tid ) : tid( tid ), events( new event[buffer_capacity] ) {}
+
+    const int tid;
+    std::unique_ptr<event[]> events;
+    // Number of events ever written, only advanced by the owning thread
+    std::atomic<int64_t> head{ 0 };
+};
+
+// Buffers are never freed, so the events of threads that exited can still be exported
+std::array<std::atomic<thread_buffer *>, max_threads> buffers{};
+std::atomic<int> buffer_count{ 0 };
+thread_local thread_buffer *local_buffer = nullptr;
+thread_local bool local_buffer_failed = false;
+
+int64_t capture_start_ns = 0;
+std::optional<cata_path> capture_path;
+
+thread_buffer *get_local_buffer()
+{
+    if( local_buffer == nullptr && !local_buffer_failed ) {
+        const int tid = buffer_count.fetch_add( 1, std::memory_order_relaxed );
+        if( tid >= max_threads ) {
+            local_buffer_failed = true;
+            return nullptr;
+        }
+        local_buffer = new thread_buffer( tid );
+        buffers[tid].store( local_buffer, std::memory_order_release );
+    }
+    return local_buffer;
+}
+
+void collect( const thread_buffer &buf, std::vector<std::pair<int, event>> &out )
+{
+    const int64_t head = buf.head.load( std::memory_order_acquire );
+    const int64_t first = std::max<int64_t>( 0, head - buffer_capacity + 1 );
+    std::vector<std::pair<int64_t, event>> copied;
+    copied.reserve( head - first );
+    for( int64_t i = first; i < head; i++ ) {
+        copied.emplace_back( i, buf.events[i % buffer_capacity] );
+    }
+    // A thread that was still finishing a zone may have overwritten the oldest events while
+    // they were copied, drop those.
+    std::atomic_thread_fence( std::memory_order_acquire );
+    const int64_t valid_from = buf.head.load( std::memory_order_relaxed ) - buffer_capacity + 1;
+    for( const std::pair<int64_t, event> &e : copied ) {
+        if( e.first >= valid_from && e.second.start_ns >= capture_start_ns ) {
+            out.emplace_back( buf.tid, e.second );
+        }
+    }
+}
+
+void write_trace( std::ostream &stream, std::vector<std::pair<int, event>> &events )
+{
+    std::sort( events.begin(), events.end(), []( const std::pair<int, event> &lhs,
+    const std::pair<int, event> &rhs ) {
+        return lhs.second.start_ns < rhs.second.start_ns;
+    } );
+    JsonOut jsout( stream );
+    jsout.start_object();
+    jsout.member( "displayTimeUnit", "ms" );
+    jsout.member( "traceEvents" );
+    jsout.start_array();
+    for( const std::pair<int, event> &e : events ) {
+        jsout.start_object();
+        jsout.member( "name", e.second.z->name );
+        jsout.member( "cat", e.second.z->category );
+        jsout.member( "ph", "X" );
+        // Timestamps are in microseconds
+        jsout.member( "ts", ( e.second.start_ns - capture_start_ns ) / 1000 );
+        jsout.member( "dur", ( e.second.end_ns - e.second.start_ns ) / 1000 );
+        jsout.member( "pid", 1 );
+        jsout.member( "tid", e.first );
+        jsout.end_object();
+    }
+    jsout.end_array();
+    jsout.end_object();
+}
+
+} // namespace
+
+namespace detail
+{
+
+std::atomic<bool> capture_enabled{ false };
+
+int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+void record( const zone &z, int64_t start_ns, int64_t end_ns )
+{
+    thread_buffer *buf = get_local_buffer();
+    if( buf == nullptr ) {
+        return;
+    }
+    const int64_t head = buf->head.load( std::memory_order_relaxed );
+    buf->events[head % buffer_capacity] = event{ &z, start_ns, end_ns };
+    buf->head.store( head + 1, std::memory_order_release );
+}
+
+} // namespace detail
+
+void start_capture( const cata_path &trace_path )
+{
+    capture_start_ns = detail::now_ns();
+    capture_path = trace_path;
+    detail::capture_enabled.store( true, std::memory_order_release );
+    DebugLog( D_INFO, D_MAIN ) << "Started profiler capture to " << trace_path.generic_u8string();
+}
+
+bool stop_capture()
+{
+    if( !capturing() || !capture_path ) {
+        return false;
+    }
+    detail::capture_enabled.store( false, std::memory_order_release );
+    std::vector<std::pair<int, event>> events;
+    const int count = std::min( buffer_count.load( std::memory_order_relaxed ), max_threads );
+    for( int i = 0; i < count; i++ ) {
+        // A thread may have claimed its slot without publishing the buffer yet
+        if( const thread_buffer *buf = buffers[i].load( std::memory_order_acquire ) ) {
+            collect( *buf, events );
+        }
+    }
+    const cata_path path = *capture_path;
+    capture_path.reset();
+    DebugLog( D_INFO, D_MAIN ) << "Writing " << events.size() << " profiler events to " <<
+                               path.generic_u8string();
+    return write_to_file( path, [&events]( std::ostream & stream ) {
+        write_trace( stream, events );
+    }, _( "profiler trace" ) );
+}
+
+} // namespace cata_profiler
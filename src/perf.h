@@ -4,6 +4,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <iostream>
@@ -15,6 +16,8 @@
 
 #include "debug.h"
 
+class cata_path;
+
 struct cata_timer {
         struct timer_stats {
             std::string name;
@@ -80,4 +83,74 @@ struct cata_timer {
         static std::vector<timers_map::iterator> &timer_stack();
 };
 
+/**
+ * Zone based instrumentation for capturing where a session spends its time.
+ *
+ * Interesting stages are marked with CATA_PROFILE_ZONE, which declares a static zone
+ * descriptor and times the rest of the enclosing scope. While no capture is running a zone
+ * costs a single relaxed atomic load. During a capture every thread appends the zones it
+ * completes to its own ring buffer without taking any lock, and stopping the capture writes
+ * them out in the Chrome trace event format, which chrome://tracing or Perfetto can open.
+ */
+namespace cata_profiler
+{
+
+/** Static description of an instrumented stage. */
+struct zone {
+    const char *name;
+    const char *category;
+};
+
+namespace detail
+{
+extern std::atomic<bool> capture_enabled;
+int64_t now_ns();
+void record( const zone &z, int64_t start_ns, int64_t end_ns );
+} // namespace detail
+
+inline bool capturing()
+{
+    return detail::capture_enabled.load( std::memory_order_relaxed );
+}
+
+/** Starts capturing zones on all threads. The trace is written to @p trace_path when the capture stops. */
+void start_capture( const cata_path &trace_path );
+/**
+ * Ends the running capture and writes its trace.
+ * Returns false if no capture was running or the trace could not be written.
+ */
+bool stop_capture();
+
+/** Times the scope it lives in as one occurrence of a zone, if a capture is running. */
+class scoped_zone
+{
+    public:
+        explicit scoped_zone( const zone &z ) : z( capturing() ? &z : nullptr ) {
+            if( this->z != nullptr ) {
+                start_ns = detail::now_ns();
+            }
+        }
+        ~scoped_zone() {
+            if( z != nullptr ) {
+                detail::record( *z, start_ns, detail::now_ns() );
+            }
+        }
+        scoped_zone( const scoped_zone & ) = delete;
+        scoped_zone &operator=( const scoped_zone & ) = delete;
+
+    private:
+        const zone *z;
+        int64_t start_ns = 0;
+};
+
+} // namespace cata_profiler
+
+#define CATA_PROFILE_CONCAT_IMPL( a, b ) a##b
+#define CATA_PROFILE_CONCAT( a, b ) CATA_PROFILE_CONCAT_IMPL( a, b )
+/** Profiles the rest of the enclosing scope as the zone @p name in @p category (string literals). */
+#define CATA_PROFILE_ZONE( name, category ) \
+    static constexpr cata_profiler::zone CATA_PROFILE_CONCAT( cata_profile_zone_, __LINE__ ){ name, category }; \
+    const cata_profiler::scoped_zone CATA_PROFILE_CONCAT( cata_profile_scope_, __LINE__ )( \
+            CATA_PROFILE_CONCAT( cata_profile_zone_, __LINE__ ) )
+
 #endif // CATA_SRC_PERF_H
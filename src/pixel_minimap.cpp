@@ -173,15 +173,15 @@ struct pixel_minimap::submap_cache {
     std::array<SDL_Color, SEEX *SEEY> minimap_colors = {};
     //checks if the submap has been looked at by the minimap routine
     bool touched = false;
-    //the texture updates are drawn to
+    //the texture the colors are uploaded to
     SDL_Texture_Ptr chunk_tex;
     //the submap being handled
     size_t texture_index = 0;
-    //the list of updates to apply to the texture
-    //reduces render target switching to once per submap
-    std::vector<point> update_list;
-    //flag used to indicate that the texture needs to be cleared before first use
-    bool ready = false;
+    //set once the colors were computed, until then the submap is recolored regardless of
+    //whether the map reported it as changed
+    bool colored = false;
+    //flag used to indicate that the colors changed since they were last uploaded to the texture
+    bool changed = false;
     shared_texture_pool &pool;
 
     //reserve the SEEX * SEEY submap tiles
@@ -206,10 +206,8 @@ struct pixel_minimap::submap_cache {
     }
 };
 
-pixel_minimap::pixel_minimap( const SDL_Renderer_Ptr &renderer,
-                              const GeometryRenderer_Ptr &geometry ) :
+pixel_minimap::pixel_minimap( const SDL_Renderer_Ptr &renderer ) :
     renderer( renderer ),
-    geometry( geometry ),
     type( pixel_minimap_type::ortho ),
     screen_rect{ 0, 0, 0, 0 }
 {
@@ -261,61 +259,59 @@ void pixel_minimap::clear_unused_cache()
     }
 }
 
-//draws individual updates to the submap cache texture
-//the render target will be set back to display_buffer after all submaps are updated
+//rasterizes the colors of every changed submap into a pixel buffer and uploads it to the
+//submap texture at once, which is cheaper than drawing each changed tile to the texture
 void pixel_minimap::flush_cache_updates()
 {
+    const point chunk_size = projector->get_tiles_size( { SEEX, SEEY } );
+    std::vector<Uint32> pixels;
+
     for( auto &mcp : cache ) {
-        if( mcp.second.update_list.empty() ) {
+        submap_cache &cache_item = mcp.second;
+        if( !cache_item.changed || !cache_item.chunk_tex ) {
             continue;
         }
 
-        SetRenderTarget( renderer, mcp.second.chunk_tex );
-
-        if( !mcp.second.ready ) {
-            mcp.second.ready = true;
-
-            SetRenderDrawColor( renderer, 0x00, 0x00, 0x00, 0x00 );
-            RenderClear( renderer );
-
-            for( int y = 0; y < SEEY; ++y ) {
-                for( int x = 0; x < SEEX; ++x ) {
-                    const point tile_pos = projector->get_tile_pos( { x, y }, { SEEX, SEEY } );
-                    const point tile_size = projector->get_tile_size();
-
-                    const SDL_Rect rect = SDL_Rect{ tile_pos.x, tile_pos.y, tile_size.x, tile_size.y };
-
-                    geometry->rect( renderer, rect, SDL_Color() );
+        //the space between the tiles stays transparent
+        pixels.assign( static_cast<size_t>( chunk_size.x ) * chunk_size.y, 0 );
+
+        for( int y = 0; y < SEEY; ++y ) {
+            for( int x = 0; x < SEEX; ++x ) {
+                const point tile_pos = projector->get_tile_pos( { x, y }, { SEEX, SEEY } );
+                const SDL_Color c = cache_item.color_at( { x, y } );
+                const Uint32 argb = ( static_cast<Uint32>( c.a ) << 24 ) | ( static_cast<Uint32>( c.r ) << 16 ) |
+                                    ( static_cast<Uint32>( c.g ) << 8 ) | static_cast<Uint32>( c.b );
+
+                const int x_end = std::min( tile_pos.x + pixel_size.x, chunk_size.x );
+                const int y_end = std::min( tile_pos.y + pixel_size.y, chunk_size.y );
+                for( int py = std::max( tile_pos.y, 0 ); py < y_end; ++py ) {
+                    Uint32 *const row = pixels.data() + static_cast<size_t>( py ) * chunk_size.x;
+                    std::fill( row + std::max( tile_pos.x, 0 ), row + std::max( x_end, 0 ), argb );
                 }
             }
         }
 
-        for( const point &p : mcp.second.update_list ) {
-            const point tile_pos = projector->get_tile_pos( p, { SEEX, SEEY } );
-            const SDL_Color tile_color = mcp.second.color_at( p );
-
-            if( pixel_size.x == 1 && pixel_size.y == 1 ) {
-                SetRenderDrawColor( renderer, tile_color.r, tile_color.g, tile_color.b, tile_color.a );
-                RenderDrawPoint( renderer, tile_pos );
-            } else {
-                geometry->rect( renderer, tile_pos, pixel_size.x, pixel_size.y, tile_color );
-            }
-        }
-
-        mcp.second.update_list.clear();
+        UpdateTexture( cache_item.chunk_tex, nullptr, pixels.data(),
+                       chunk_size.x * static_cast<int>( sizeof( Uint32 ) ) );
+        cache_item.changed = false;
     }
 }
 
-void pixel_minimap::update_cache_at( const tripoint_bub_sm &sm_pos )
+void pixel_minimap::update_cache_at( const tripoint_bub_sm &sm_pos, const bool dirty )
 {
     const map &here = get_map();
     const level_cache &access_cache = here.access_cache( sm_pos.z() );
-    const bool nv_goggle = get_player_character().get_vision_modes()[NV_GOGGLES];
 
     submap_cache &cache_item = get_cache_at( here.get_abs_sub() + rebase_rel( sm_pos ) );
     const tripoint_bub_ms ms_pos = coords::project_to<coords::ms>( sm_pos );
 
     cache_item.touched = true;
+    if( cache_item.colored && !dirty ) {
+        return;
+    }
+    //a texture taken from the pool still shows whatever submap it was last used for
+    cache_item.changed |= !cache_item.colored;
+    cache_item.colored = true;
 
     for( int y = 0; y < SEEY; ++y ) {
         for( int x = 0; x < SEEX; ++x ) {
@@ -331,7 +327,7 @@ void pixel_minimap::update_cache_at( const tripoint_bub_sm &sm_pos )
                 color = get_map_color_at( p );
 
                 //color terrain according to lighting conditions
-                if( nv_goggle ) {
+                if( nv_goggles ) {
                     if( lighting == lit_level::LOW ) {
                         color = color_pixel_nightvision( color );
                     } else if( lighting != lit_level::DARK && lighting != lit_level::BLANK ) {
@@ -348,7 +344,7 @@ void pixel_minimap::update_cache_at( const tripoint_bub_sm &sm_pos )
 
             if( current_color != color ) {
                 current_color = color;
-                cache_item.update_list.emplace_back( x, y );
+                cache_item.changed = true;
             }
         }
     }
@@ -369,9 +365,17 @@ void pixel_minimap::process_cache( const tripoint_bub_ms &center )
 {
     prepare_cache_for_updates( center );
 
+    std::bitset<MAPSIZE *MAPSIZE> dirty = get_map().take_display_dirty( center.z() );
+    //the goggles change the colors of every lit tile
+    const bool goggles = get_player_character().get_vision_modes()[NV_GOGGLES];
+    if( goggles != nv_goggles ) {
+        nv_goggles = goggles;
+        dirty.set();
+    }
+
     for( int y = 0; y < MAPSIZE; ++y ) {
         for( int x = 0; x < MAPSIZE; ++x ) {
-            update_cache_at( { x, y, center.z()} );
+            update_cache_at( { x, y, center.z()}, dirty[x * MAPSIZE + y] );
         }
     }
 
@@ -425,7 +429,9 @@ void pixel_minimap::set_screen_rect( const SDL_Rect &screen_rect )
     const point chunk_size = projector->get_tiles_size( { SEEX, SEEY } );
 
     const auto chunk_texture_generator = [&chunk_size, this]() {
-        SDL_Texture_Ptr result = create_cache_texture( renderer, chunk_size.x, chunk_size.y );
+        //the submap textures are only ever written with UpdateTexture
+        SDL_Texture_Ptr result = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888,
+                                                SDL_TEXTUREACCESS_STREAMING, chunk_size.x, chunk_size.y );
         SetTextureBlendMode( result, SDL_BLENDMODE_BLEND );
         return result;
     };
@@ -8,7 +8,6 @@
 #include "coordinates.h"
 #include "point.h"
 #include "sdl_wrappers.h"
-#include "sdl_geometry.h"
 
 class pixel_minimap_projector;
 
@@ -35,7 +34,7 @@ struct pixel_minimap_settings {
 class pixel_minimap
 {
     public:
-        pixel_minimap( const SDL_Renderer_Ptr &renderer, const GeometryRenderer_Ptr &geometry );
+        explicit pixel_minimap( const SDL_Renderer_Ptr &renderer );
         ~pixel_minimap();
 
         void set_type( pixel_minimap_type type );
@@ -56,7 +55,8 @@ class pixel_minimap
         void process_cache( const tripoint_bub_ms &center );
 
         void flush_cache_updates();
-        void update_cache_at( const tripoint_bub_sm &pos );
+        // recolors the submap at pos if it is new to the cache or dirty, i.e. the map reported it changed
+        void update_cache_at( const tripoint_bub_sm &pos, bool dirty );
         void prepare_cache_for_updates( const tripoint_bub_ms &center );
         void clear_unused_cache();
 
@@ -67,13 +67,15 @@ class pixel_minimap
         std::unique_ptr<pixel_minimap_projector> create_projector( const SDL_Rect &max_screen_rect ) const;
 
         const SDL_Renderer_Ptr &renderer;
-        const GeometryRenderer_Ptr &geometry;
 
         pixel_minimap_type type;
         pixel_minimap_settings settings;
 
         point pixel_size;
 
+        //whether the colors in the cache were computed for night vision goggles
+        bool nv_goggles = false;
+
         //track the previous viewing area to determine if the minimap cache needs to be cleared
         tripoint_abs_sm cached_center_sm;
 
@@ -572,12 +572,12 @@ std::string relic::name() const
     return item_name_override.translated();
 }
 
-std::vector<enchant_cache> relic::get_proc_enchantments() const
+const std::vector<enchant_cache> &relic::get_proc_enchantments() const
 {
     return proc_passive_effects;
 }
 
-std::vector<enchantment> relic::get_defined_enchantments() const
+const std::vector<enchantment> &relic::get_defined_enchantments() const
 {
     return defined_passive_effects;
 }
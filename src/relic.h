@@ -243,8 +243,8 @@ class relic
         void add_passive_effect( const enchantment &ench );
         void add_active_effect( const fake_spell &sp );
 
-        std::vector<enchant_cache> get_proc_enchantments() const;
-        std::vector<enchantment> get_defined_enchantments() const;
+        const std::vector<enchant_cache> &get_proc_enchantments() const;
+        const std::vector<enchantment> &get_defined_enchantments() const;
 
         void overwrite_charge( const relic_charge_info &info );
 
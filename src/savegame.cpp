@@ -135,16 +135,14 @@ void game::serialize_json( std::ostream &fout )
                  inactive_global_effect_on_condition_vector );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_global_effect_on_conditions );
     json.member( "queued_global_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc &queued : queued_global_effect_on_conditions.list ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued.time );
+        json.member( "eoc", queued.eoc );
+        json.member( "context", queued.context );
         json.end_object();
-        temp_queued.pop();
     }
     json.end_array();
     global_variables_instance.serialize( json );
@@ -1822,6 +1820,7 @@ void creature_tracker::deserialize( const JsonArray &ja )
 {
     monsters_list.clear();
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     for( JsonValue jv : ja ) {
         // TODO: would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
         shared_ptr_fast<monster> mptr = make_shared_fast<monster>();
@@ -1891,6 +1890,7 @@ void npc::import_and_clean( const JsonObject &data )
     last_updated = defaults.last_updated;
     lifespan_end = defaults.lifespan_end;
     effects->clear();
+    invalidate_flag_index();
     consumption_history = defaults.consumption_history;
     last_sleep_check = defaults.last_sleep_check;
     queued_effect_on_conditions = defaults.queued_effect_on_conditions;
@@ -645,6 +645,8 @@ void Character::load( const JsonObject &data )
 {
     data.allow_omitted_members();
     Creature::load( data );
+    // Effects and body parts were replaced without going through the usual hooks
+    invalidate_flag_index();
 
     // stats
     data.read( "str_cur", str_cur );
@@ -1314,6 +1316,7 @@ void Character::load( const JsonObject &data )
         queued_effect_on_conditions.push( temp );
     }
     data.read( "inactive_eocs", inactive_effect_on_condition_vector );
+    invalidate_flag_index();
 }
 
 /**
@@ -1542,16 +1545,14 @@ void Character::store( JsonOut &json ) const
     json.member( "suppress_autohaul", suppress_autohaul );
 
     //save queued effect_on_conditions
-    queued_eocs temp_queued( queued_effect_on_conditions );
     json.member( "queued_effect_on_conditions" );
     json.start_array();
-    while( !temp_queued.empty() ) {
+    for( const queued_eoc &queued : queued_effect_on_conditions.list ) {
         json.start_object();
-        json.member( "time", temp_queued.top().time );
-        json.member( "eoc", temp_queued.top().eoc );
-        json.member( "context", temp_queued.top().context );
+        json.member( "time", queued.time );
+        json.member( "eoc", queued.eoc );
+        json.member( "context", queued.context );
         json.end_object();
-        temp_queued.pop();
     }
 
     json.end_array();
@@ -124,6 +124,17 @@ void SetTextureBlendMode( const SDL_Texture_Ptr &texture, SDL_BlendMode blendMod
                   "SDL_SetTextureBlendMode failed" );
 }
 
+void UpdateTexture( const SDL_Texture_Ptr &texture, const SDL_Rect *const rect,
+                    const void *const pixels, const int pitch )
+{
+    if( !texture ) {
+        dbg( D_ERROR ) << "Tried to use a null texture";
+        return;
+    }
+    printErrorIf( SDL_UpdateTexture( texture.get(), rect, pixels, pitch ) != 0,
+                  "SDL_UpdateTexture failed" );
+}
+
 bool SetTextureColorMod( const SDL_Texture_Ptr &texture, Uint32 r, Uint32 g, Uint32 b )
 {
     if( !texture ) {
@@ -7,6 +7,8 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "activity_type.h"
 #include "cached_options.h" // IWYU pragma: keep
@@ -30,6 +32,7 @@
 #include "npc.h"
 #include "output.h"
 #include "overmapbuffer.h"
+#include "perf.h"
 #include "player_activity.h"
 #include "point.h"
 #include "rng.h"
@@ -457,11 +460,108 @@ static int get_signal_for_hordes( const centroid &centr )
     return 0;
 }
 
+namespace
+{
+// Buckets the monsters of the reality bubble by submap and z-level once per
+// call to process_sounds, so each sound cluster only visits the listeners that
+// are close enough to possibly hear it instead of every monster on the map.
+class sound_listener_index
+{
+    public:
+        explicit sound_listener_index( const map &here );
+
+        // Calls fn for every indexed monster whose horizontal distance from
+        // source is below range, in the order g->all_monsters() yields them.
+        template<typename Fn>
+        void for_each_in_range( const tripoint_bub_ms &source, int range, Fn &&fn );
+
+    private:
+        int bucket_index( const tripoint_bub_ms &p ) const;
+
+        int mapsize;
+        // Listeners sorted by bucket, bucket i spans
+        // [bucket_start[i], bucket_start[i + 1]). Each listener remembers its
+        // position in the monster iteration order.
+        std::vector<std::pair<int, monster *>> listeners;
+        std::vector<int> bucket_start;
+        // Monsters that are somehow outside the bubble are always candidates.
+        std::vector<std::pair<int, monster *>> out_of_bounds;
+        std::vector<std::pair<int, monster *>> candidates;
+};
+
+sound_listener_index::sound_listener_index( const map &here ) : mapsize( here.getmapsize() )
+{
+    std::vector<std::pair<int, monster *>> unsorted;
+    std::vector<int> buckets;
+    bucket_start.assign( mapsize * mapsize * OVERMAP_LAYERS + 1, 0 );
+    int ordinal = 0;
+    for( monster &critter : g->all_monsters() ) {
+        const tripoint_bub_ms pos = critter.pos_bub();
+        if( !here.inbounds( pos ) ) {
+            out_of_bounds.emplace_back( ordinal++, &critter );
+            continue;
+        }
+        const int bucket = bucket_index( pos );
+        unsorted.emplace_back( ordinal++, &critter );
+        buckets.push_back( bucket );
+        bucket_start[bucket + 1]++;
+    }
+    for( size_t i = 1; i < bucket_start.size(); i++ ) {
+        bucket_start[i] += bucket_start[i - 1];
+    }
+    listeners.resize( unsorted.size() );
+    std::vector<int> fill( bucket_start.begin(), bucket_start.end() - 1 );
+    for( size_t i = 0; i < unsorted.size(); i++ ) {
+        listeners[fill[buckets[i]]++] = unsorted[i];
+    }
+}
+
+int sound_listener_index::bucket_index( const tripoint_bub_ms &p ) const
+{
+    return ( ( p.z() + OVERMAP_DEPTH ) * mapsize + p.y() / SEEY ) * mapsize + p.x() / SEEX;
+}
+
+template<typename Fn>
+void sound_listener_index::for_each_in_range( const tripoint_bub_ms &source, int range, Fn &&fn )
+{
+    candidates.clear();
+    // sound_distance is never less than the horizontal rl_dist, so a
+    // listener further than range along either axis can't hear the sound.
+    const int min_x = std::max( 0, ( source.x() - range ) / SEEX );
+    const int max_x = std::min( mapsize - 1, ( source.x() + range ) / SEEX );
+    const int min_y = std::max( 0, ( source.y() - range ) / SEEY );
+    const int max_y = std::min( mapsize - 1, ( source.y() + range ) / SEEY );
+    for( int z = -OVERMAP_DEPTH; min_x <= max_x && z <= OVERMAP_HEIGHT; z++ ) {
+        for( int y = min_y; y <= max_y; y++ ) {
+            const int row = ( ( z + OVERMAP_DEPTH ) * mapsize + y ) * mapsize;
+            const int begin = bucket_start[row + min_x];
+            const int end = bucket_start[row + max_x + 1];
+            candidates.insert( candidates.end(), listeners.begin() + begin, listeners.begin() + end );
+        }
+    }
+    candidates.insert( candidates.end(), out_of_bounds.begin(), out_of_bounds.end() );
+    // Keep the original iteration order so monster reactions stay deterministic.
+    std::sort( candidates.begin(), candidates.end() );
+    for( const std::pair<int, monster *> &candidate : candidates ) {
+        // A sound-triggered trap may have killed a listener earlier this pass.
+        if( !candidate.second->is_dead() ) {
+            fn( *candidate.second );
+        }
+    }
+}
+} // namespace
+
 void sounds::process_sounds()
 {
+    CATA_PROFILE_ZONE( "process_sounds", "turn" );
     map &here = get_map();
 
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
+    if( sound_clusters.empty() ) {
+        recent_sounds.clear();
+        return;
+    }
+    sound_listener_index listeners( here );
     const int weather_vol = get_weather().weather_id->sound_attn;
     for( const centroid &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
@@ -480,13 +580,15 @@ void sounds::process_sounds()
             overmap_buffer.signal_hordes( target, sig_power );
         }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
-            // TODO: Generalize this to Creature::hear_sound
-            const int dist = sound_distance( source, critter.pos_bub() );
-            if( vol * 2 > dist ) {
-                // Exclude monsters that certainly won't hear the sound
-                critter.hear_sound( source, vol, dist, this_centroid.provocative );
-            }
+        if( vol > 0 ) {
+            listeners.for_each_in_range( source, vol * 2, [&]( monster & critter ) {
+                // TODO: Generalize this to Creature::hear_sound
+                const int dist = sound_distance( source, critter.pos_bub() );
+                if( vol * 2 > dist ) {
+                    // Exclude monsters that certainly won't hear the sound
+                    critter.hear_sound( source, vol, dist, this_centroid.provocative );
+                }
+            } );
         }
         // Trigger sound-triggered traps and ensure they are still valid
         for( const trap *trapType : trap::get_sound_triggered_traps() ) {
@@ -0,0 +1,285 @@
+#include "submap_view.h"
+
+#include <utility>
+
+#include "calendar.h"
+#include "coordinates.h"
+#include "debug.h"
+#include "enums.h"
+#include "field.h"
+#include "flag.h"
+#include "game_constants.h"
+#include "item.h"
+#include "item_factory.h"
+#include "map.h"
+#include "map_scale_constants.h"
+#include "mapbuffer.h"
+#include "mapdata.h"
+#include "point.h"
+#include "rng.h"
+#include "submap.h"
+#include "trap.h"
+
+static const ter_str_id ter_t_dirt( "t_dirt" );
+static const ter_str_id ter_t_dirtmound( "t_dirtmound" );
+
+void submap_view::load( const tripoint_abs_omt &w )
+{
+    pos = w;
+    const tripoint_abs_sm base = project_to<coords::sm>( w );
+    bool generated = false;
+    for( int i = 0; i < 4; i++ ) {
+        const tripoint_abs_sm sm_pos = base + point_rel_sm( i % 2, i / 2 );
+        submaps[i] = MAPBUFFER.lookup_submap( sm_pos );
+        if( submaps[i] == nullptr && !generated ) {
+            // Loading a tinymap generates the whole OMT, after that all of it can be looked up
+            tinymap generator;
+            generator.load( w, false );
+            generated = true;
+            submaps[i] = MAPBUFFER.lookup_submap( sm_pos );
+        }
+        if( submaps[i] == nullptr ) {
+            debugmsg( "submap_view failed to load the submap at %s", sm_pos.to_string() );
+        }
+    }
+}
+
+void submap_view::save()
+{
+    for( submap *sm : submaps ) {
+        if( sm != nullptr ) {
+            sm->last_touched = calendar::turn;
+        }
+    }
+}
+
+bool submap_view::inbounds( const tripoint_omt_ms &p ) const
+{
+    return p.x() >= 0 && p.x() < 2 * SEEX && p.y() >= 0 && p.y() < 2 * SEEY && p.z() == pos.z();
+}
+
+tripoint_abs_ms submap_view::get_abs( const tripoint_omt_ms &p ) const
+{
+    return project_to<coords::ms>( pos ) + tripoint_rel_ms( p.x(), p.y(), 0 );
+}
+
+tripoint_range<tripoint_omt_ms> submap_view::points_on_zlevel() const
+{
+    return tripoint_range<tripoint_omt_ms>( tripoint_omt_ms( 0, 0, pos.z() ),
+                                            tripoint_omt_ms( 2 * SEEX - 1, 2 * SEEY - 1, pos.z() ) );
+}
+
+submap *submap_view::get_submap_at( const tripoint_omt_ms &p, point_sm_ms &l ) const
+{
+    if( !inbounds( p ) ) {
+        return nullptr;
+    }
+    l = point_sm_ms( p.x() % SEEX, p.y() % SEEY );
+    return submaps[p.x() / SEEX + p.y() / SEEY * 2];
+}
+
+bool submap_view::in_reality_bubble( const tripoint_omt_ms &p ) const
+{
+    return get_map().inbounds( get_abs( p ) );
+}
+
+ter_id submap_view::ter( const tripoint_omt_ms &p ) const
+{
+    point_sm_ms l;
+    const submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return ter_str_id::NULL_ID().id();
+    }
+    return current_submap->get_ter( l );
+}
+
+bool submap_view::ter_set( const tripoint_omt_ms &p, const ter_id &new_terrain )
+{
+    point_sm_ms l;
+    submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return false;
+    }
+    if( in_reality_bubble( p ) ) {
+        map &here = get_map();
+        return here.ter_set( here.get_bub( get_abs( p ) ), new_terrain );
+    }
+    if( current_submap->get_ter( l ) == new_terrain ) {
+        return false;
+    }
+    current_submap->set_ter( l, new_terrain );
+    current_submap->set_map_damage( l, 0 );
+
+    const ter_t &new_t = new_terrain.obj();
+    if( !new_t.liquid_source_item_id.is_null() &&
+        new_t.liquid_source_count != std::make_pair( 0, 0 ) ) {
+        item water( new_t.liquid_source_item_id, calendar::start_of_cataclysm );
+        water.charges = rng( new_t.liquid_source_count.first, new_t.liquid_source_count.second );
+        add_item_or_charges( p, water );
+    }
+    return true;
+}
+
+furn_id submap_view::furn( const tripoint_omt_ms &p ) const
+{
+    point_sm_ms l;
+    const submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return furn_str_id::NULL_ID().id();
+    }
+    return current_submap->get_furn( l );
+}
+
+bool submap_view::has_furn( const tripoint_omt_ms &p ) const
+{
+    return furn( p ) != furn_str_id::NULL_ID();
+}
+
+bool submap_view::furn_set( const tripoint_omt_ms &p, const furn_id &new_furniture )
+{
+    point_sm_ms l;
+    submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return false;
+    }
+    if( in_reality_bubble( p ) ) {
+        map &here = get_map();
+        return here.furn_set( here.get_bub( get_abs( p ) ), new_furniture );
+    }
+    if( current_submap->get_furn( l ) == new_furniture ) {
+        return true;
+    }
+    current_submap->set_furn( l, new_furniture );
+    current_submap->set_map_damage( l, 0 );
+
+    if( new_furniture->has_flag( ter_furn_flag::TFLAG_PLANT ) &&
+        current_submap->get_ter( l ) == ter_t_dirtmound ) {
+        ter_set( p, ter_t_dirt );
+    }
+    return true;
+}
+
+void submap_view::set( const tripoint_omt_ms &p, const ter_id &new_terrain,
+                       const furn_id &new_furniture )
+{
+    furn_set( p, new_furniture );
+    ter_set( p, new_terrain );
+}
+
+const cata::colony<item> &submap_view::i_at( const tripoint_omt_ms &p ) const
+{
+    static const cata::colony<item> null_items;
+    point_sm_ms l;
+    const submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return null_items;
+    }
+    return current_submap->get_items( l );
+}
+
+bool submap_view::add_item_or_charges( const tripoint_omt_ms &p, const item &obj )
+{
+    point_sm_ms l;
+    submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return false;
+    }
+    if( in_reality_bubble( p ) ) {
+        map &here = get_map();
+        return !here.add_item_or_charges( here.get_bub( get_abs( p ) ), obj, false ).is_null();
+    }
+    if( item_is_blacklisted( obj.typeId() ) || obj.has_flag( flag_NO_DROP ) ) {
+        return false;
+    }
+    const ter_t &t = current_submap->get_ter( l ).obj();
+    const furn_t &f = current_submap->get_furn( l ).obj();
+    const bool liquid = obj.made_of_from_type( phase_id::LIQUID );
+    if( ter_furn_has_flag( t, f, ter_furn_flag::TFLAG_DESTROY_ITEM ) ||
+        ( liquid && ter_furn_has_flag( t, f, ter_furn_flag::TFLAG_SWIMMABLE ) ) ) {
+        return false;
+    }
+    if( ter_furn_has_flag( t, f, ter_furn_flag::TFLAG_NOITEM ) &&
+        !( liquid && ter_furn_has_flag( t, f, ter_furn_flag::TFLAG_LIQUIDCONT ) ) ) {
+        return false;
+    }
+
+    current_submap->ensure_nonuniform();
+    cata::colony<item> &items = current_submap->get_items( l );
+    if( obj.count_by_charges() ) {
+        for( item &e : items ) {
+            if( e.merge_charges( obj ) ) {
+                return true;
+            }
+        }
+    }
+    if( items.size() >= MAX_ITEM_IN_SQUARE ) {
+        return false;
+    }
+    current_submap->update_lum_add( l, obj );
+    const cata::colony<item>::iterator new_pos = items.insert( obj );
+    current_submap->active_items.add( *new_pos, l );
+    return true;
+}
+
+void submap_view::i_clear( const tripoint_omt_ms &p )
+{
+    point_sm_ms l;
+    submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return;
+    }
+    if( in_reality_bubble( p ) ) {
+        map &here = get_map();
+        here.i_clear( here.get_bub( get_abs( p ) ) );
+        return;
+    }
+    current_submap->set_lum( l, 0 );
+    current_submap->get_items( l ).clear();
+}
+
+const field &submap_view::field_at( const tripoint_omt_ms &p ) const
+{
+    static const field null_field;
+    point_sm_ms l;
+    const submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return null_field;
+    }
+    return current_submap->get_field( l );
+}
+
+const trap &submap_view::tr_at( const tripoint_omt_ms &p ) const
+{
+    point_sm_ms l;
+    const submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return tr_null.obj();
+    }
+    const trap_id &builtin_trap = current_submap->get_ter( l )->trap;
+    if( builtin_trap != tr_null ) {
+        return *builtin_trap;
+    }
+    return current_submap->get_trap( l ).obj();
+}
+
+void submap_view::trap_set( const tripoint_omt_ms &p, const trap_id &type )
+{
+    point_sm_ms l;
+    submap *const current_submap = get_submap_at( p, l );
+    if( current_submap == nullptr ) {
+        return;
+    }
+    if( in_reality_bubble( p ) ) {
+        map &here = get_map();
+        here.trap_set( here.get_bub( get_abs( p ) ), type );
+        return;
+    }
+    const ter_t &ter = current_submap->get_ter( l ).obj();
+    if( ter.trap != tr_null ) {
+        debugmsg( "set trap %s (%s) at %s on top of terrain %s (%s) which already has a "
+                  "built-in trap", type.id().str(), type->name(), get_abs( p ).to_string(),
+                  ter.id.str(), ter.name() );
+        return;
+    }
+    current_submap->set_trap( l, type );
+}
@@ -0,0 +1,74 @@
+#pragma once
+#ifndef CATA_SRC_SUBMAP_VIEW_H
+#define CATA_SRC_SUBMAP_VIEW_H
+
+#include <array>
+
+#include "colony.h"
+#include "coordinates.h"
+#include "map_iterator.h"
+#include "type_id.h"
+
+class field;
+class item;
+class submap;
+struct trap;
+
+/**
+* A view of the submaps of a single overmap terrain (OMT) tile on a single Z level, addressed
+* like a tinymap with tripoint_omt_ms. Unlike tinymap it holds nothing but the four submap
+* pointers: there are no level, pathfinding or vehicle caches to allocate, set up or keep up
+* to date, so it is cheap to create and load repeatedly from code that works on the map away
+* from the reality bubble, like faction camp missions.
+*
+* Changes made to points within the reality bubble go through the main map, so its caches stay
+* correct. Elsewhere only the submaps themselves are changed, none of the map's side effects
+* on creatures, the avatar's memory or things falling down apply. Vehicles are not visible.
+*/
+class submap_view
+{
+    public:
+        /**
+        * Makes the submaps of @p w available. Those that do not exist yet are generated, which
+        * is the only case that needs a tinymap.
+        */
+        void load( const tripoint_abs_omt &w );
+        /** Marks the submaps as touched now, like tinymap::save does. */
+        void save();
+
+        bool inbounds( const tripoint_omt_ms &p ) const;
+        tripoint_abs_ms get_abs( const tripoint_omt_ms &p ) const;
+        tripoint_range<tripoint_omt_ms> points_on_zlevel() const;
+
+        ter_id ter( const tripoint_omt_ms &p ) const;
+        bool ter_set( const tripoint_omt_ms &p, const ter_id &new_terrain );
+        furn_id furn( const tripoint_omt_ms &p ) const;
+        bool has_furn( const tripoint_omt_ms &p ) const;
+        bool furn_set( const tripoint_omt_ms &p, const furn_id &new_furniture );
+        void set( const tripoint_omt_ms &p, const ter_id &new_terrain, const furn_id &new_furniture );
+
+        const cata::colony<item> &i_at( const tripoint_omt_ms &p ) const;
+        /**
+        * Places @p obj on the tile, merging its charges into an item already there when it
+        * can. Returns false if the tile destroys or can not hold the item. Does not overflow
+        * to neighboring tiles.
+        */
+        bool add_item_or_charges( const tripoint_omt_ms &p, const item &obj );
+        void i_clear( const tripoint_omt_ms &p );
+
+        const field &field_at( const tripoint_omt_ms &p ) const;
+        const trap &tr_at( const tripoint_omt_ms &p ) const;
+        void trap_set( const tripoint_omt_ms &p, const trap_id &type );
+
+    private:
+        /** Returns the submap @p p is on and sets @p l to the position within it. */
+        submap *get_submap_at( const tripoint_omt_ms &p, point_sm_ms &l ) const;
+        /** Whether @p p is within the reality bubble, whose map has to be changed instead. */
+        bool in_reality_bubble( const tripoint_omt_ms &p ) const;
+
+        tripoint_abs_omt pos;
+        // Indexed by x + y * 2 of the submap within the OMT
+        std::array<submap *, 4> submaps = {};
+};
+
+#endif // CATA_SRC_SUBMAP_VIEW_H
@@ -0,0 +1,199 @@
+#pragma once
+#ifndef CATA_SRC_TIMER_WHEEL_H
+#define CATA_SRC_TIMER_WHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * Hierarchical timer wheel keyed by turn number.
+ *
+ * Level 0 has one slot per turn for the next 64 turns, each higher level has slots 64 times
+ * as wide. An entry is placed in the lowest level that can hold its due time and moves down
+ * a level when the slot it is in comes up, so inserting is O(1) and every entry is touched
+ * at most once per level before it expires. Entries further ahead than the top level covers
+ * wait in an overflow list.
+ */
+template<typename T>
+class timer_wheel
+{
+    public:
+        /** Schedules @p value for @p time. Entries at or before the current turn are due at once. */
+        void insert( int time, const T &value );
+        /**
+         * Advances the wheel to @p now and appends the values of all entries due at or before
+         * it to @p out, ordered by due time.
+         */
+        void expire( int now, std::vector<T> &out );
+
+        bool empty() const {
+            return count == 0;
+        }
+        size_t size() const {
+            return count;
+        }
+        void clear();
+
+        /** Calls @p fn( time, value ) for every entry, in no particular order. */
+        template<typename Fn>
+        void for_each( Fn &&fn ) const;
+
+    private:
+        struct entry {
+            int time;
+            T value;
+        };
+        static constexpr int slot_bits = 6;
+        static constexpr int slot_count = 1 << slot_bits;
+        static constexpr int levels = 4;
+        using level = std::array<std::vector<entry>, slot_count>;
+
+        void place( entry &&e );
+        void cascade( std::vector<entry> &slot );
+        void step();
+        void rebuild( int now );
+
+        std::array<level, levels> wheel;
+        std::vector<entry> overflow;
+        std::vector<entry> due;
+        // Last turn the wheel was advanced to
+        int cursor = 0;
+        size_t count = 0;
+};
+
+template<typename T>
+void timer_wheel<T>::insert( int time, const T &value )
+{
+    place( entry{ time, value } );
+    count++;
+}
+
+template<typename T>
+void timer_wheel<T>::place( entry &&e )
+{
+    if( e.time <= cursor ) {
+        due.push_back( std::move( e ) );
+        return;
+    }
+    const int64_t delta = static_cast<int64_t>( e.time ) - cursor;
+    for( int l = 0; l < levels; l++ ) {
+        if( delta < int64_t( 1 ) << ( slot_bits * ( l + 1 ) ) ) {
+            wheel[l][( e.time >> ( slot_bits * l ) ) & ( slot_count - 1 )].push_back( std::move( e ) );
+            return;
+        }
+    }
+    overflow.push_back( std::move( e ) );
+}
+
+template<typename T>
+void timer_wheel<T>::cascade( std::vector<entry> &slot )
+{
+    std::vector<entry> entries;
+    entries.swap( slot );
+    for( entry &e : entries ) {
+        place( std::move( e ) );
+    }
+}
+
+template<typename T>
+void timer_wheel<T>::step()
+{
+    cursor++;
+    // Move down the entries of every level whose slot boundary was crossed, top level first so
+    // they can fall through to the lower ones.
+    int top = 0;
+    while( top + 1 < levels && ( cursor & ( ( 1 << ( slot_bits * ( top + 1 ) ) ) - 1 ) ) == 0 ) {
+        top++;
+    }
+    if( top == levels - 1 ) {
+        cascade( overflow );
+    }
+    for( int l = top; l > 0; l-- ) {
+        cascade( wheel[l][( cursor >> ( slot_bits * l ) ) & ( slot_count - 1 )] );
+    }
+    std::vector<entry> &slot = wheel[0][cursor & ( slot_count - 1 )];
+    std::move( slot.begin(), slot.end(), std::back_inserter( due ) );
+    slot.clear();
+}
+
+template<typename T>
+void timer_wheel<T>::rebuild( int now )
+{
+    std::vector<entry> entries;
+    entries.swap( overflow );
+    // Entries due at the old cursor may not be due anymore when going back in time
+    std::move( due.begin(), due.end(), std::back_inserter( entries ) );
+    due.clear();
+    for( level &lv : wheel ) {
+        for( std::vector<entry> &slot : lv ) {
+            std::move( slot.begin(), slot.end(), std::back_inserter( entries ) );
+            slot.clear();
+        }
+    }
+    cursor = now;
+    for( entry &e : entries ) {
+        place( std::move( e ) );
+    }
+}
+
+template<typename T>
+void timer_wheel<T>::expire( int now, std::vector<T> &out )
+{
+    // Stepping through a long gap or back in time costs more than placing everything again
+    if( now < cursor || static_cast<int64_t>( now ) - cursor > slot_count ) {
+        rebuild( now );
+    } else {
+        while( cursor < now ) {
+            step();
+        }
+    }
+    if( due.empty() ) {
+        return;
+    }
+    std::stable_sort( due.begin(), due.end(), []( const entry & lhs, const entry & rhs ) {
+        return lhs.time < rhs.time;
+    } );
+    for( entry &e : due ) {
+        out.push_back( std::move( e.value ) );
+    }
+    count -= due.size();
+    due.clear();
+}
+
+template<typename T>
+void timer_wheel<T>::clear()
+{
+    for( level &lv : wheel ) {
+        for( std::vector<entry> &slot : lv ) {
+            slot.clear();
+        }
+    }
+    overflow.clear();
+    due.clear();
+    count = 0;
+}
+
+template<typename T>
+template<typename Fn>
+void timer_wheel<T>::for_each( Fn &&fn ) const
+{
+    const auto visit = [&fn]( const std::vector<entry> &entries ) {
+        for( const entry &e : entries ) {
+            fn( e.time, e.value );
+        }
+    };
+    for( const level &lv : wheel ) {
+        for( const std::vector<entry> &slot : lv ) {
+            visit( slot );
+        }
+    }
+    visit( overflow );
+    visit( due );
+}
+
+#endif // CATA_SRC_TIMER_WHEEL_H
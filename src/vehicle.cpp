@@ -245,7 +245,10 @@ vehicle::vehicle( const vproto_id &proto_id )
     }
 }
 
-vehicle::~vehicle() = default;
+vehicle::~vehicle()
+{
+    invalidate_power_grids();
+}
 
 turret_cpu::~turret_cpu() = default;
 
@@ -2679,16 +2682,13 @@ std::vector<int> vehicle::parts_at_relative( const point_rel_ms &dp, const bool
             }
         }
     } else {
-        const auto &iter = relative_parts.find( dp );
-        if( iter != relative_parts.end() ) {
-            if( include_fake ) {
-                return iter->second;
-            } else {
-                for( const int vp : iter->second ) {
-                    if( !parts.at( vp ).is_fake ) {
-                        res.push_back( vp );
-                    }
-                }
+        const vehicle_part_grid::parts_range parts_here = relative_parts.at( dp );
+        if( include_fake ) {
+            return parts_here.to_vector();
+        }
+        for( const int vp : parts_here ) {
+            if( !parts.at( vp ).is_fake ) {
+                res.push_back( vp );
             }
         }
     }
@@ -2879,20 +2879,18 @@ int vehicle::part_with_feature( int part, vpart_bitflags flag, bool unbroken,
     if( vp.info().has_flag( flag ) && !( unbroken && vp.is_broken() ) ) {
         return part;
     }
-    for( const int p : parts_at_relative( vp.mount, /* use_cache = */ true, include_fake ) ) {
-        const vehicle_part &vp_here = this->part( p );
-        if( vp_here.info().has_flag( flag ) && !( unbroken && vp_here.is_broken() ) ) {
-            return p;
-        }
-    }
-    return -1;
+    return part_with_feature( vp.mount, flag, unbroken, include_fake );
 }
 
 int vehicle::part_with_feature( const point_rel_ms &pt, vpart_bitflags f, bool unbroken,
                                 bool include_fake ) const
 {
-    for( const int p : parts_at_relative( pt, /* use_cache = */ true, include_fake ) ) {
+    // Walk the cached range directly, this is called for every part on every collision check.
+    for( const int p : relative_parts.at( pt ) ) {
         const vehicle_part &vp_here = this->part( p );
+        if( !include_fake && vp_here.is_fake ) {
+            continue;
+        }
         if( vp_here.info().has_flag( f ) && !( unbroken && vp_here.is_broken() ) ) {
             return p;
         }
@@ -3703,7 +3701,7 @@ int64_t vehicle::fuel_left( map &here, const itype_id &ftype,
 {
     int64_t fl = 0;
     if( ftype == fuel_type_battery ) {
-        for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+        for( const std::pair<vehicle *const, float> &pair : get_power_grid( here ).members ) {
             const vehicle &veh = *pair.first;
             const float loss = pair.second;
             for( const int part_idx : veh.batteries ) {
@@ -3770,7 +3768,7 @@ int vehicle::fuel_capacity( map &here, const itype_id &ftype ) const
 {
     if( ftype == fuel_type_battery ) { // batteries get special treatment due to power cables
         int64_t capacity = 0;
-        for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+        for( const std::pair<vehicle *const, float> &pair : get_power_grid( here ).members ) {
             const vehicle &veh = *pair.first;
             for( const int part_idx : veh.batteries ) {
                 const vehicle_part &vp = veh.parts[part_idx];
@@ -5236,7 +5234,7 @@ std::pair<int, int> vehicle::connected_battery_power_level( const map &here ) co
     int total_epower_remaining = 0;
     int total_epower_capacity = 0;
 
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+    for( const std::pair<vehicle *const, float> &pair : get_power_grid( here ).members ) {
         int epower_remaining;
         int epower_capacity;
         std::tie( epower_remaining, epower_capacity ) = pair.first->battery_power_level( );
@@ -5602,6 +5600,20 @@ vehicle *vehicle::find_vehicle_using_parts( const map &here,  const tripoint_abs
     return nullptr;
 }
 
+// helper method to calculate power loss weighted by capacity
+static double weighted_power_loss( const std::map<vpart_reference, float> &batteries )
+{
+    double res = 0.0; // sum of power losses
+    int64_t total_capacity = 0; // sum of capacity of all batteries
+    for( const std::pair<const vpart_reference, float> &pair : batteries ) {
+        vehicle_part &vp = pair.first.part();
+        const int capacity = vp.ammo_capacity( ammo_battery );
+        total_capacity += capacity;
+        res += pair.second * capacity;
+    }
+    return res / total_capacity;
+}
+
 template<typename Vehicle> // Templated to support const and non-const vehicle*
 std::map<Vehicle *, float> vehicle::search_connected_vehicles( const map &here, Vehicle *start )
 {
@@ -5646,12 +5658,64 @@ std::map<Vehicle *, float> vehicle::search_connected_vehicles( const map &here,
 
 std::map<vehicle *, float> vehicle::search_connected_vehicles( const map &here )
 {
-    return search_connected_vehicles( here, this );
+    return get_power_grid( here ).members;
 }
 
 std::map<const vehicle *, float> vehicle::search_connected_vehicles( const map &here ) const
 {
-    return search_connected_vehicles( here, this );
+    const std::map<vehicle *, float> &members = get_power_grid( here ).members;
+    return std::map<const vehicle *, float>( members.begin(), members.end() );
+}
+
+// Bumped by anything that may add, remove or change vehicles a power grid refers to.
+static uint64_t power_grid_generation = 1;
+
+void vehicle::invalidate_power_grids()
+{
+    power_grid_generation++;
+}
+
+const vehicle_power_grid &vehicle::get_power_grid( const map &here ) const
+{
+    bool valid = power_grid.root == this && power_grid.generation == power_grid_generation;
+    if( valid ) {
+        // Moving a vehicle doesn't touch the generation, but it may move cables out of reach.
+        auto position = power_grid.member_positions.begin();
+        for( const std::pair<vehicle *const, float> &member : power_grid.members ) {
+            if( member.first->pos_abs() != position->first || member.first->face.dir() != position->second ) {
+                valid = false;
+                break;
+            }
+            ++position;
+        }
+    }
+    if( valid ) {
+        return power_grid;
+    }
+
+    vehicle_power_grid grid;
+    grid.root = this;
+    // The search doesn't modify the vehicles, it only hands out non-const pointers to them.
+    grid.members = search_connected_vehicles( here, const_cast<vehicle *>( this ) );
+    // Set after searching, the search may have loaded submaps and created vehicles.
+    grid.generation = power_grid_generation;
+    for( const std::pair<vehicle *const, float> &member : grid.members ) {
+        vehicle *veh = member.first;
+        grid.member_positions.emplace_back( veh->pos_abs(), veh->face.dir() );
+        for( const int part_idx : veh->batteries ) {
+            const vpart_reference vpr( *veh, part_idx );
+            if( vpr.part().is_fake ) {
+                continue;
+            }
+            grid.batteries.emplace( vpr, member.second );
+            grid.total_capacity += vpr.part().ammo_capacity( ammo_battery );
+        }
+    }
+    if( !grid.batteries.empty() ) {
+        grid.weighted_loss = weighted_power_loss( grid.batteries );
+    }
+    power_grid = std::move( grid );
+    return power_grid;
 }
 
 void vehicle::get_connected_vehicles( const map &here, std::unordered_set<vehicle *> &dest )
@@ -5675,35 +5739,7 @@ void vehicle::get_connected_vehicles( const map &here, std::unordered_set<vehicl
 
 std::map<vpart_reference, float> vehicle::search_connected_batteries( map &here )
 {
-    std::map<vpart_reference, float> result;
-
-    for( const std::pair<vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
-        vehicle *veh = pair.first;
-        const float efficiency = pair.second;
-        for( const int part_idx : veh->batteries ) {
-            const vpart_reference vpr( *veh, part_idx );
-            if( vpr.part().is_fake ) {
-                continue;
-            }
-            result.emplace( vpr, efficiency );
-        }
-    }
-
-    return result;
-}
-
-// helper method to calculate power loss weighted by capacity
-static double weighted_power_loss( const std::map<vpart_reference, float> &batteries )
-{
-    double res = 0.0; // sum of power losses
-    int64_t total_capacity = 0; // sum of capacity of all batteries
-    for( const std::pair<const vpart_reference, float> &pair : batteries ) {
-        vehicle_part &vp = pair.first.part();
-        const int capacity = vp.ammo_capacity( ammo_battery );
-        total_capacity += capacity;
-        res += pair.second * capacity;
-    }
-    return res / total_capacity;
+    return get_power_grid( here ).batteries;
 }
 
 // helper method to take a map of batteries, amount of charge, total capacity of batteries
@@ -5740,7 +5776,7 @@ static void distribute_charge_evenly( const std::map<vpart_reference, float> &ba
 
 bool vehicle::is_battery_available( map &here ) const
 {
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+    for( const std::pair<vehicle *const, float> &pair : get_power_grid( here ).members ) {
         const vehicle &veh = *pair.first;
         for( const int part_idx : veh.batteries ) {
             const vehicle_part &vp = veh.parts[part_idx];
@@ -5755,7 +5791,7 @@ bool vehicle::is_battery_available( map &here ) const
 int64_t vehicle::battery_left( map &here, bool apply_loss ) const
 {
     int64_t ret = 0;
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+    for( const std::pair<vehicle *const, float> &pair : get_power_grid( here ).members ) {
         const vehicle &veh = *pair.first;
         const float efficiency = 1.0f - ( apply_loss ? pair.second : 0.0f );
         for( const int part_idx : veh.batteries ) {
@@ -5775,17 +5811,16 @@ int vehicle::charge_battery( map &here, int amount, bool apply_loss )
     if( amount == 0 ) {
         return 0;
     }
-    const std::map<vpart_reference, float> batteries = search_connected_batteries( here );
+    const vehicle_power_grid &grid = get_power_grid( here );
+    const std::map<vpart_reference, float> &batteries = grid.batteries;
     if( batteries.empty() ) {
         return amount;
     }
-    const double loss = apply_loss ? weighted_power_loss( batteries ) : 0.0;
+    const double loss = apply_loss ? grid.weighted_loss : 0.0;
     int64_t total_charge = 0; // sum of current charge of all batteries
-    int64_t total_capacity = 0; // sum of capacity of all batteries
+    const int64_t total_capacity = grid.total_capacity; // sum of capacity of all batteries
     for( const std::pair<const vpart_reference, float> &pair : batteries ) {
-        vehicle_part &vp = pair.first.part();
-        total_charge += vp.ammo_remaining( );
-        total_capacity += vp.ammo_capacity( ammo_battery );
+        total_charge += pair.first.part().ammo_remaining( );
     }
     const int64_t chargeable = total_capacity - total_charge;
     int64_t lost_amount = roll_remainder( amount * loss );
@@ -5818,17 +5853,16 @@ int vehicle::discharge_battery( map &here, int amount, bool apply_loss )
     if( amount == 0 ) {
         return 0;
     }
-    const std::map<vpart_reference, float> batteries = search_connected_batteries( here );
+    const vehicle_power_grid &grid = get_power_grid( here );
+    const std::map<vpart_reference, float> &batteries = grid.batteries;
     if( batteries.empty() ) {
         return amount;
     }
-    const double loss = apply_loss ? weighted_power_loss( batteries ) : 0.0;
+    const double loss = apply_loss ? grid.weighted_loss : 0.0;
     int64_t total_charge = 0; // sum of current charge of all batteries
-    int64_t total_capacity = 0; // sum of capacity of all batteries
+    const int64_t total_capacity = grid.total_capacity; // sum of capacity of all batteries
     for( const std::pair<const vpart_reference, float> &pair : batteries ) {
-        vehicle_part &vp = pair.first.part();
-        total_charge += vp.ammo_remaining( );
-        total_capacity += vp.ammo_capacity( ammo_battery );
+        total_charge += pair.first.part().ammo_remaining( );
     }
 
     int64_t discharged = amount;
@@ -6441,8 +6475,8 @@ void vehicle::refresh( const bool remove_fakes )
     sails.clear();
     water_wheels.clear();
     funnels.clear();
+    funnel_tanks.clear();
     emitters.clear();
-    relative_parts.clear();
     loose_parts.clear();
     wheelcache.clear();
     rail_wheelcache.clear();
@@ -6486,6 +6520,9 @@ void vehicle::refresh( const bool remove_fakes )
     smart_controller_state = std::nullopt;
 
     bool refresh_done = false;
+    // (mount, part) pairs for relative_parts, it is built in one go after the loop.
+    std::vector<std::pair<point_rel_ms, int>> mounted_parts;
+    mounted_parts.reserve( parts.size() );
 
     // Main loop over all vehicle parts.
     for( const vpart_reference &vp : get_all_parts() ) {
@@ -6503,11 +6540,7 @@ void vehicle::refresh( const bool remove_fakes )
         mount_max.x() = std::max( mount_max.x(), pt.x() );
         mount_max.y() = std::max( mount_max.y(), pt.y() );
 
-        // This will keep the parts at point pt sorted
-        std::vector<int>::iterator vii = std::lower_bound( relative_parts[pt].begin(),
-                                         relative_parts[pt].end(),
-                                         static_cast<int>( p ), svpv );
-        relative_parts[pt].insert( vii, p );
+        mounted_parts.emplace_back( pt, static_cast<int>( p ) );
 
         //If it doesn't leak or it's health is less than 50% then The hull has been breached and the air is leaking out
         if( vpi.has_flag( VPFLAG_FLOATS ) && ( vpi.has_flag( VPFLAG_NO_LEAK ) ||
@@ -6623,6 +6656,20 @@ void vehicle::refresh( const bool remove_fakes )
         }
     }
 
+    // This will keep the parts at each mount point sorted
+    relative_parts.assign( mounted_parts, svpv );
+
+    // Look up the tanks below the funnels once, update_time only checks if they can take water.
+    for( const int funnel : funnels ) {
+        std::vector<int> &tanks = funnel_tanks.emplace_back();
+        for( const int p : relative_parts.at( parts[funnel].mount ) ) {
+            if( parts[p].is_tank() ) {
+                tanks.push_back( p );
+            }
+        }
+        std::sort( tanks.begin(), tanks.end() );
+    }
+
     rail_wheel_bounding_box.p1 = point_rel_ms( railwheel_xmin, railwheel_ymin );
     rail_wheel_bounding_box.p2 = point_rel_ms( railwheel_xmax, railwheel_ymax );
     front_left.x() = mount_max.x();
@@ -6656,8 +6703,8 @@ void vehicle::refresh( const bool remove_fakes )
             vehicle_part &part_real = parts.at( real_index );
             if( part_real.has_fake &&
                 static_cast<size_t>( part_real.fake_part_at ) < parts.size() ) {
-                relative_parts[ parts[ part_real.fake_part_at ].mount].push_back(
-                    part_real.fake_part_at );
+                relative_parts.push_back( parts[ part_real.fake_part_at ].mount,
+                                          part_real.fake_part_at );
                 return;
             }
             vehicle_part part_fake( parts.at( real_index ) );
@@ -6676,7 +6723,7 @@ void vehicle::refresh( const bool remove_fakes )
             int fake_index = parts.size();
             part_real.fake_part_at = fake_index;
             fake_parts.push_back( fake_index );
-            relative_parts[ part_fake.mount].push_back( fake_index );
+            relative_parts.push_back( part_fake.mount, fake_index );
             edges.emplace( real_mount, edge_info );
             parts.push_back( std::move( part_fake ) );
         }
@@ -6685,10 +6732,10 @@ void vehicle::refresh( const bool remove_fakes )
     // guarantee that the fake parts were removed before being added
     if( remove_fakes && !has_tag( "wreckage" ) && !is_appliance() ) {
         // Calling add_fake_part can change that container, so iterate over a copy instead.
-        const decltype( relative_parts ) copy_of_relative_parts = relative_parts;
+        const std::vector<point_rel_ms> real_mounts = relative_parts.mounts();
         // add all the obstacles first
-        for( const std::pair <const point_rel_ms, std::vector<int>> &rp : copy_of_relative_parts ) {
-            add_fake_part( rp.first, "OBSTACLE" );
+        for( const point_rel_ms &mount : real_mounts ) {
+            add_fake_part( mount, "OBSTACLE" );
         }
         // then add protrusions that hanging on top of fake obstacles.
 
@@ -6698,12 +6745,12 @@ void vehicle::refresh( const bool remove_fakes )
         }
 
         // add fake camera parts so vision isn't blocked by fake parts
-        for( const std::pair <const point_rel_ms, std::vector<int>> &rp : copy_of_relative_parts ) {
-            add_fake_part( rp.first, "CAMERA" );
+        for( const point_rel_ms &mount : real_mounts ) {
+            add_fake_part( mount, "CAMERA" );
         }
         // add fake curtains so vision is correctly blocked
-        for( const std::pair <const point_rel_ms, std::vector<int>> &rp : copy_of_relative_parts ) {
-            add_fake_part( rp.first, "CURTAIN" );
+        for( const point_rel_ms &mount : real_mounts ) {
+            add_fake_part( mount, "CURTAIN" );
         }
     } else {
         // Always repopulate fake parts in relative_parts cache since we cleared it.
@@ -6711,8 +6758,7 @@ void vehicle::refresh( const bool remove_fakes )
             if( parts[fake_index].removed ) {
                 continue;
             }
-            point_rel_ms pt = parts[fake_index].mount;
-            relative_parts[pt].push_back( fake_index );
+            relative_parts.push_back( parts[fake_index].mount, fake_index );
         }
     }
 
@@ -6727,6 +6773,7 @@ void vehicle::refresh( const bool remove_fakes )
     invalidate_mass();
     occupied_cache_pos = tripoint_abs_ms::invalid;
     refresh_active_item_cache();
+    invalidate_power_grids();
 }
 
 vpart_edge_info vehicle::get_edge_info( const point_rel_ms &mount ) const
@@ -6741,27 +6788,23 @@ vpart_edge_info vehicle::get_edge_info( const point_rel_ms &mount ) const
     int r_index = -1;
     bool left_side = false;
     bool right_side = false;
-    if( relative_parts.find( forward ) != relative_parts.end() &&
-        !parts.at( relative_parts.at( forward ).front() ).is_fake ) {
-        f_index = relative_parts.at( forward ).front();
-    }
-    if( relative_parts.find( aft ) != relative_parts.end() &&
-        !parts.at( relative_parts.at( aft ).front() ).is_fake ) {
-        a_index = relative_parts.at( aft ).front();
-    }
-    if( relative_parts.find( left ) != relative_parts.end() &&
-        !parts.at( relative_parts.at( left ).front() ).is_fake ) {
-        l_index = relative_parts.at( left ).front();
-        if( parts.at( relative_parts.at( left ).front() ).info().has_flag( "PROTRUSION" ) ) {
-            left_side = true;
+    // The first part at a mount point is fake only if there are no real parts there.
+    const auto first_real_part = [this]( const point_rel_ms & pt ) {
+        const vehicle_part_grid::parts_range parts_here = relative_parts.at( pt );
+        if( parts_here.empty() || parts.at( parts_here.front() ).is_fake ) {
+            return -1;
         }
+        return parts_here.front();
+    };
+    f_index = first_real_part( forward );
+    a_index = first_real_part( aft );
+    l_index = first_real_part( left );
+    if( l_index >= 0 && parts.at( l_index ).info().has_flag( "PROTRUSION" ) ) {
+        left_side = true;
     }
-    if( relative_parts.find( right ) != relative_parts.end() &&
-        !parts.at( relative_parts.at( right ).front() ).is_fake ) {
-        r_index = relative_parts.at( right ).front();
-        if( parts.at( relative_parts.at( right ).front() ).info().has_flag( "PROTRUSION" ) ) {
-            right_side = true;
-        }
+    r_index = first_real_part( right );
+    if( r_index >= 0 && parts.at( r_index ).info().has_flag( "PROTRUSION" ) ) {
+        right_side = true;
     }
     return vpart_edge_info( f_index, a_index, l_index, r_index, left_side, right_side );
 }
@@ -8016,12 +8059,13 @@ const std::set<tripoint_abs_ms> &vehicle::get_points( const bool force_refresh,
         occupied_cache_pos = pos_abs();
         occupied_cache_direction = face.dir();
         occupied_points.clear();
-        for( const std::pair<const point_rel_ms, std::vector<int>> &part_location : relative_parts ) {
-            if( no_fake && part( part_location.second.front() ).is_fake ) {
-                continue;
+        relative_parts.for_each_mount( [&]( const point_rel_ms &,
+        const vehicle_part_grid::parts_range & parts_here ) {
+            if( no_fake && part( parts_here.front() ).is_fake ) {
+                return;
             }
-            occupied_points.insert( abs_part_pos( part_location.second.front() ) );
-        }
+            occupied_points.insert( abs_part_pos( parts_here.front() ) );
+        } );
     }
 
     return occupied_points;
@@ -8216,11 +8260,61 @@ void vehicle::update_time( map &here, const time_point &update_to )
     // Get one weather data set per vehicle, they don't differ much across vehicle area
     const weather_sum accum_weather = sum_conditions( update_from, update_to,
                                       pos_abs() );
+    if( !funnels.empty() ) {
+        fill_funnel_tanks( here, accum_weather );
+    }
+
+    // Add up everything the generators made while we were away and charge the batteries once.
+    int energy_bat = 0;
+    if( !solar_panels.empty() ) {
+        units::power epower = 0_W;
+        for( const int p : solar_panels ) {
+            const vehicle_part &vp = parts[p];
+            const tripoint_bub_ms pos = bub_part_pos( here, vp );
+            if( vp.is_unavailable() || !is_sm_tile_outside( here.get_abs( pos ) ) ) {
+                continue;
+            }
+            epower += part_epower( vp );
+        }
+        double intensity = accum_weather.radiant_exposure / max_sun_irradiance() / to_seconds<float>
+                           ( elapsed );
+        const int solar_energy = power_to_energy_bat( epower * intensity, elapsed );
+        if( solar_energy > 0 ) {
+            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from solar panels", name, solar_energy );
+            energy_bat += solar_energy;
+        }
+    }
+    if( !wind_turbines.empty() ) {
+        // TODO: use accum_weather wind data to backfill wind turbine
+        // generation capacity.
+        units::power epower = total_wind_epower( here );
+        const int wind_energy = power_to_energy_bat( epower, elapsed );
+        if( wind_energy > 0 ) {
+            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from wind turbines", name, wind_energy );
+            energy_bat += wind_energy;
+        }
+    }
+    if( !water_wheels.empty() ) {
+        units::power epower = total_water_wheel_epower( here );
+        const int water_energy = power_to_energy_bat( epower, elapsed );
+        if( water_energy > 0 ) {
+            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from water wheels", name, water_energy );
+            energy_bat += water_energy;
+        }
+    }
+    if( energy_bat > 0 ) {
+        charge_battery( here, energy_bat );
+    }
+}
+
+void vehicle::fill_funnel_tanks( map &here, const weather_sum &accum_weather )
+{
     // make some reference objects to use to check for reload
     const item water( itype_water );
     const item water_clean( itype_water_clean );
 
-    for( int idx : funnels ) {
+    for( size_t i = 0; i < funnels.size(); i++ ) {
+        const int idx = funnels[i];
         const vehicle_part &pt = parts[idx];
 
         // we need an unbroken funnel mounted on the exterior of the vehicle
@@ -8229,12 +8323,16 @@ void vehicle::update_time( map &here, const time_point &update_to )
         }
 
         // we need an empty tank (or one already containing water) below the funnel
-        auto tank = std::find_if( parts.begin(), parts.end(), [&]( const vehicle_part & e ) {
-            return pt.mount == e.mount && e.is_tank() &&
-                   ( e.can_reload( water ) || e.can_reload( water_clean ) );
-        } );
+        vehicle_part *tank = nullptr;
+        for( const int tank_idx : funnel_tanks[i] ) {
+            vehicle_part &e = parts[tank_idx];
+            if( e.can_reload( water ) || e.can_reload( water_clean ) ) {
+                tank = &e;
+                break;
+            }
+        }
 
-        if( tank == parts.end() ) {
+        if( tank == nullptr ) {
             continue;
         }
 
@@ -8256,43 +8354,6 @@ void vehicle::update_time( map &here, const time_point &update_to )
             invalidate_mass();
         }
     }
-
-    if( !solar_panels.empty() ) {
-        units::power epower = 0_W;
-        for( const int p : solar_panels ) {
-            const vehicle_part &vp = parts[p];
-            const tripoint_bub_ms pos = bub_part_pos( here, vp );
-            if( vp.is_unavailable() || !is_sm_tile_outside( here.get_abs( pos ) ) ) {
-                continue;
-            }
-            epower += part_epower( vp );
-        }
-        double intensity = accum_weather.radiant_exposure / max_sun_irradiance() / to_seconds<float>
-                           ( elapsed );
-        int energy_bat = power_to_energy_bat( epower * intensity, elapsed );
-        if( energy_bat > 0 ) {
-            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from solar panels", name, energy_bat );
-            charge_battery( here, energy_bat );
-        }
-    }
-    if( !wind_turbines.empty() ) {
-        // TODO: use accum_weather wind data to backfill wind turbine
-        // generation capacity.
-        units::power epower = total_wind_epower( here );
-        int energy_bat = power_to_energy_bat( epower, elapsed );
-        if( energy_bat > 0 ) {
-            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from wind turbines", name, energy_bat );
-            charge_battery( here, energy_bat );
-        }
-    }
-    if( !water_wheels.empty() ) {
-        units::power epower = total_water_wheel_epower( here );
-        int energy_bat = power_to_energy_bat( epower, elapsed );
-        if( energy_bat > 0 ) {
-            add_msg_debug( debugmode::DF_VEHICLE, "%s got %d kJ energy from water wheels", name, energy_bat );
-            charge_battery( here, energy_bat );
-        }
-    }
 }
 
 void vehicle::invalidate_mass()
@@ -8637,7 +8698,7 @@ tripoint_bub_ms vehicle::exhaust_dest( map *here, int part ) const
 {
     point_rel_ms p = parts[part].mount;
     // Move back from engine/muffler until we find an open space
-    while( relative_parts.find( p ) != relative_parts.end() ) {
+    while( relative_parts.has_parts( p ) ) {
         p.x() += ( velocity < 0 ? 1 : -1 );
     }
     point_rel_ms q = coord_translate( p );
@@ -46,6 +46,7 @@
 #include "tileray.h"
 #include "type_id.h"
 #include "units.h"
+#include "vehicle_part_grid.h"
 #include "vpart_position.h"
 #include "vpart_range.h"
 
@@ -64,6 +65,7 @@ enum class ter_furn_flag : int;
 enum vpart_bitflags : int;
 struct itype;
 struct vehicle_part;
+struct weather_sum;
 template <typename E> struct enum_traits;
 
 void handbrake( map &here );
@@ -717,6 +719,29 @@ enum class autodrive_result : int {
 
 class RemovePartHandler;
 
+/**
+ * The vehicles connected to a vehicle through POWER_TRANSFER parts (cables and the like),
+ * as found by vehicle::search_connected_vehicles, together with their batteries.
+ * Each vehicle keeps its own grid and only searches again when a vehicle has been
+ * created, destroyed or refreshed, or when one of the members has moved.
+ */
+struct vehicle_power_grid {
+    // Vehicle the grid was built for, copies of a vehicle don't inherit its grid.
+    const vehicle *root = nullptr;
+    // Value of the global grid generation when this was built.
+    uint64_t generation = 0;
+    // Connected vehicles (including root) and their line loss from root.
+    std::map<vehicle *, float> members;
+    // Where each member was and how it was facing when the grid was built.
+    std::vector<std::pair<tripoint_abs_ms, units::angle>> member_positions;
+    // Non-fake batteries of all members and their line loss from root.
+    std::map<vpart_reference, float> batteries;
+    // Sum of the capacity of all batteries, in kJ.
+    int64_t total_capacity = 0;
+    // Line loss of the batteries weighted by their capacity.
+    double weighted_loss = 0.0;
+};
+
 class vpart_display
 {
     public:
@@ -911,6 +936,11 @@ class vehicle
         /// Values are line loss, 0.01 corresponds to 1% charge loss to wire resistance
         /// May load the connected vehicles' submaps
         std::map<vpart_reference, float> search_connected_batteries( map &here );
+        /// Returns the cached result of search_connected_vehicles and search_connected_batteries,
+        /// searching again only if the connections may have changed since the last call.
+        const vehicle_power_grid &get_power_grid( const map &here ) const;
+        /// Makes every vehicle search its connections again on the next get_power_grid call.
+        static void invalidate_power_grids();
 
         // constructs a vehicle, if the given \p proto_id is an empty string the vehicle is
         // constructed empty, invalid proto_id will construct empty and raise a debugmsg,
@@ -2197,6 +2227,8 @@ class vehicle
         // Retroactively pass time spent outside bubble
         // Funnels, solar panels
         void update_time( map &here, const time_point &update_to );
+        // Part of update_time, pours the rain collected by the funnels into their tanks
+        void fill_funnel_tanks( map &here, const weather_sum &accum_weather );
 
         // The faction that owns this vehicle.
         faction_id owner = faction_id::NULL_ID();
@@ -2278,6 +2310,8 @@ class vehicle
         std::vector<int> water_wheels; // NOLINT(cata-serialize)
         std::vector<int> sails; // NOLINT(cata-serialize)
         std::vector<int> funnels; // NOLINT(cata-serialize)
+        // Tanks at the mount point of each funnel, in part order, parallel to funnels.
+        std::vector<std::vector<int>> funnel_tanks; // NOLINT(cata-serialize)
         std::vector<int> emitters; // NOLINT(cata-serialize)
         // Parts that will fall off and cables that might disconnect when the vehicle moves.
         std::vector<int> loose_parts; // NOLINT(cata-serialize)
@@ -2307,7 +2341,9 @@ class vehicle
          */
         vproto_id type;
         // parts_at_relative(dp) is used a lot (to put it mildly)
-        std::map<point_rel_ms, std::vector<int>> relative_parts; // NOLINT(cata-serialize)
+        vehicle_part_grid relative_parts; // NOLINT(cata-serialize)
+        // cache for get_power_grid
+        mutable vehicle_power_grid power_grid; // NOLINT(cata-serialize)
         std::set<label> labels;            // stores labels
         std::set<std::string> tags;        // Properties of the vehicle
         // After fuel consumption, this tracks the remainder of fuel < 1, and applies it the next time.
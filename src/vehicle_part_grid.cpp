@@ -0,0 +1,97 @@
+#include "vehicle_part_grid.h"
+
+#include "point.h"
+
+void vehicle_part_grid::clear()
+{
+    min = point_rel_ms::zero;
+    width = 0;
+    height = 0;
+    cells.clear();
+    indices.clear();
+}
+
+bool vehicle_part_grid::empty() const
+{
+    return indices.empty();
+}
+
+bool vehicle_part_grid::in_grid( const point_rel_ms &mount ) const
+{
+    return mount.x() >= min.x() && mount.x() < min.x() + width &&
+           mount.y() >= min.y() && mount.y() < min.y() + height;
+}
+
+size_t vehicle_part_grid::cell_index( const point_rel_ms &mount ) const
+{
+    return static_cast<size_t>( mount.y() - min.y() ) * width + ( mount.x() - min.x() );
+}
+
+void vehicle_part_grid::resize( const point_rel_ms &new_min, const point_rel_ms &new_max )
+{
+    std::vector<cell> old_cells( static_cast<size_t>( new_max.x() - new_min.x() + 1 ) *
+                                 ( new_max.y() - new_min.y() + 1 ) );
+    std::swap( old_cells, cells );
+    const point_rel_ms old_min = min;
+    const int old_width = width;
+    const int old_height = height;
+    min = new_min;
+    width = new_max.x() - new_min.x() + 1;
+    height = new_max.y() - new_min.y() + 1;
+    for( int y = 0; y < old_height; y++ ) {
+        for( int x = 0; x < old_width; x++ ) {
+            cells[cell_index( old_min + point( x, y ) )] = old_cells[static_cast<size_t>( y ) * old_width + x];
+        }
+    }
+}
+
+void vehicle_part_grid::push_back( const point_rel_ms &mount, const int part )
+{
+    if( !in_grid( mount ) ) {
+        if( width == 0 ) {
+            resize( mount, mount );
+        } else {
+            resize( point_rel_ms( std::min( min.x(), mount.x() ), std::min( min.y(), mount.y() ) ),
+                    point_rel_ms( std::max( min.x() + width - 1, mount.x() ),
+                                  std::max( min.y() + height - 1, mount.y() ) ) );
+        }
+    }
+    cell &c = cells[cell_index( mount )];
+    const int end = static_cast<int>( indices.size() );
+    if( c.count > 0 && c.first + c.count != end ) {
+        // The cell is followed by another one, move it to the end of the array so it can grow.
+        // Only fake parts are added this way, so the abandoned slots stay few.
+        for( int i = 0; i < c.count; i++ ) {
+            indices.push_back( indices[c.first + i] );
+        }
+        c.first = end;
+    } else if( c.count == 0 ) {
+        c.first = end;
+    }
+    indices.push_back( part );
+    c.count++;
+}
+
+bool vehicle_part_grid::has_parts( const point_rel_ms &mount ) const
+{
+    return in_grid( mount ) && cells[cell_index( mount )].count > 0;
+}
+
+vehicle_part_grid::parts_range vehicle_part_grid::at( const point_rel_ms &mount ) const
+{
+    if( !in_grid( mount ) ) {
+        return parts_range();
+    }
+    const cell &c = cells[cell_index( mount )];
+    const int *first = indices.data() + c.first;
+    return parts_range( first, first + c.count );
+}
+
+std::vector<point_rel_ms> vehicle_part_grid::mounts() const
+{
+    std::vector<point_rel_ms> result;
+    for_each_mount( [&result]( const point_rel_ms & mount, const parts_range & ) {
+        result.push_back( mount );
+    } );
+    return result;
+}
@@ -0,0 +1,148 @@
+#pragma once
+#ifndef CATA_SRC_VEHICLE_PART_GRID_H
+#define CATA_SRC_VEHICLE_PART_GRID_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "coordinates.h"
+
+/**
+ * Dense index of vehicle part indices by mount point.
+ *
+ * Covers the bounding box of the mount points in use with a flat grid of cells.
+ * Each cell refers to a range in one contiguous array of part indices, so looking
+ * up the parts at a mount point is a bounds check and two array reads instead of
+ * a tree search.
+ */
+class vehicle_part_grid
+{
+    public:
+        /** The part indices at one mount point, valid until the grid is modified. */
+        class parts_range
+        {
+            public:
+                parts_range() = default;
+                parts_range( const int *first, const int *last ) : first_( first ), last_( last ) {}
+
+                const int *begin() const {
+                    return first_;
+                }
+                const int *end() const {
+                    return last_;
+                }
+                bool empty() const {
+                    return first_ == last_;
+                }
+                size_t size() const {
+                    return last_ - first_;
+                }
+                int front() const {
+                    return *first_;
+                }
+                std::vector<int> to_vector() const {
+                    return std::vector<int>( first_, last_ );
+                }
+
+            private:
+                const int *first_ = nullptr;
+                const int *last_ = nullptr;
+        };
+
+        void clear();
+        bool empty() const;
+
+        /**
+         * Replaces the contents with the given (mount, part) pairs. Parts are placed
+         * in their cell in the order given, each inserted at the std::lower_bound
+         * position according to @p comp, the way sorted std::vector insertion does.
+         */
+        template<typename Compare>
+        void assign( const std::vector<std::pair<point_rel_ms, int>> &entries, Compare comp );
+        /** Appends @p part to the parts at @p mount, growing the grid if needed. */
+        void push_back( const point_rel_ms &mount, int part );
+
+        /** Whether any part is at @p mount. */
+        bool has_parts( const point_rel_ms &mount ) const;
+        /** The parts at @p mount, empty if there are none. */
+        parts_range at( const point_rel_ms &mount ) const;
+        /** All mount points with parts, ordered by x and then y. */
+        std::vector<point_rel_ms> mounts() const;
+
+        /** Calls @p fn( mount, parts ) for each occupied mount, ordered by x and then y. */
+        template<typename Fn>
+        void for_each_mount( Fn &&fn ) const;
+
+    private:
+        struct cell {
+            int first = 0;
+            int count = 0;
+        };
+
+        bool in_grid( const point_rel_ms &mount ) const;
+        size_t cell_index( const point_rel_ms &mount ) const;
+        /** Resizes the grid to cover [@p new_min, @p new_max], keeping the contents. */
+        void resize( const point_rel_ms &new_min, const point_rel_ms &new_max );
+
+        point_rel_ms min;
+        int width = 0;
+        int height = 0;
+        std::vector<cell> cells;
+        std::vector<int> indices;
+};
+
+template<typename Compare>
+void vehicle_part_grid::assign( const std::vector<std::pair<point_rel_ms, int>> &entries,
+                                Compare comp )
+{
+    clear();
+    if( entries.empty() ) {
+        return;
+    }
+    point_rel_ms lo = entries.front().first;
+    point_rel_ms hi = lo;
+    for( const std::pair<point_rel_ms, int> &e : entries ) {
+        lo = point_rel_ms( std::min( lo.x(), e.first.x() ), std::min( lo.y(), e.first.y() ) );
+        hi = point_rel_ms( std::max( hi.x(), e.first.x() ), std::max( hi.y(), e.first.y() ) );
+    }
+    // Leave room for the fake parts that are added next to the edge mounts.
+    resize( lo - point( 1, 1 ), hi + point( 1, 1 ) );
+
+    for( const std::pair<point_rel_ms, int> &e : entries ) {
+        cells[cell_index( e.first )].count++;
+    }
+    int offset = 0;
+    for( cell &c : cells ) {
+        c.first = offset;
+        offset += c.count;
+        c.count = 0;
+    }
+    indices.resize( offset );
+    for( const std::pair<point_rel_ms, int> &e : entries ) {
+        cell &c = cells[cell_index( e.first )];
+        int *first = indices.data() + c.first;
+        int *last = first + c.count;
+        int *pos = std::lower_bound( first, last, e.second, comp );
+        std::move_backward( pos, last, last + 1 );
+        *pos = e.second;
+        c.count++;
+    }
+}
+
+template<typename Fn>
+void vehicle_part_grid::for_each_mount( Fn &&fn ) const
+{
+    for( int x = 0; x < width; x++ ) {
+        for( int y = 0; y < height; y++ ) {
+            const cell &c = cells[static_cast<size_t>( y ) * width + x];
+            if( c.count > 0 ) {
+                const int *first = indices.data() + c.first;
+                fn( min + point( x, y ), parts_range( first, first + c.count ) );
+            }
+        }
+    }
+}
+
+#endif // CATA_SRC_VEHICLE_PART_GRID_H
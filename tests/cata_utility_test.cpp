@@ -408,3 +408,16 @@ TEST_CASE( "lcmatch", "[utility][nogame]" )
     CHECK( lcmatch( "無効", "無" ) == true );
     CHECK( lcmatch( "無効", "無效" ) == false );
 }
+
+TEST_CASE( "lcmatch_with_prepared_key", "[utility][nogame]" )
+{
+    const std::vector<std::string> subjects = { "bo", "Bo", "Bö", "BŌ", "«101 борцовский приём»", "無効" };
+    const std::vector<std::string> queries = { "", "bo", "bö", "bō", "co", "прИ", "прб", "無", "無效" };
+    for( const std::string &subject : subjects ) {
+        const lc_search_key key( subject );
+        for( const std::string &query : queries ) {
+            CAPTURE( subject, query );
+            CHECK( lcmatch( key, lc_search_query( query ) ) == lcmatch( subject, query ) );
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#include "cached_options.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "cata_scope_helpers.h"
+#include "character.h"
+#include "player_helpers.h"
+#include "type_id.h"
+
+static const efftype_id effect_maimed_wings( "maimed_wings" );
+
+static const json_character_flag json_flag_DISABLE_FLIGHT( "DISABLE_FLIGHT" );
+static const json_character_flag json_flag_LARGE( "LARGE" );
+
+static const trait_id trait_LARGE( "LARGE" );
+
+TEST_CASE( "character_flags_follow_trait_and_effect_changes", "[character][flags]" )
+{
+    // Debug mode checks every query against the flag sources themselves
+    restore_on_out_of_scope restore_debug_mode( debug_mode );
+    debug_mode = true;
+
+    clear_avatar();
+    Character &you = get_player_character();
+
+    REQUIRE_FALSE( you.has_flag( json_flag_LARGE ) );
+    you.set_mutation( trait_LARGE );
+    CHECK( you.has_flag( json_flag_LARGE ) );
+    CHECK( you.has_trait_flag( json_flag_LARGE ) );
+    CHECK( you.count_flag( json_flag_LARGE ) == 1 );
+    you.unset_mutation( trait_LARGE );
+    CHECK_FALSE( you.has_flag( json_flag_LARGE ) );
+    CHECK( you.count_flag( json_flag_LARGE ) == 0 );
+
+    REQUIRE_FALSE( you.has_flag( json_flag_DISABLE_FLIGHT ) );
+    you.add_effect( effect_maimed_wings, 1_hours );
+    CHECK( you.has_flag( json_flag_DISABLE_FLIGHT ) );
+    CHECK( you.count_flag( json_flag_DISABLE_FLIGHT ) == 1 );
+    // Adding to an effect the character already has keeps its flags
+    you.add_effect( effect_maimed_wings, 1_hours );
+    CHECK( you.count_flag( json_flag_DISABLE_FLIGHT ) == 1 );
+    you.remove_effect( effect_maimed_wings );
+    CHECK_FALSE( you.has_flag( json_flag_DISABLE_FLIGHT ) );
+
+    you.add_effect( effect_maimed_wings, 1_hours );
+    you.clear_effects();
+    CHECK_FALSE( you.has_flag( json_flag_DISABLE_FLIGHT ) );
+}
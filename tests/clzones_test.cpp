@@ -1,5 +1,6 @@
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "activity_actor_definitions.h"
@@ -137,6 +138,36 @@ TEST_CASE( "zone_unloading_ammo_belts", "[zones][items][ammo_belt][activities][u
 // Comestibles sorting is a bit awkward. Unlike other loot, they're almost
 // always inside of a container, and their sort zone changes based on their
 // shelf life and whether the container prevents rotting.
+TEST_CASE( "zone_range_queries_across_submaps", "[zones]" )
+{
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+
+    const tripoint_abs_ms origin( 5, 5, 0 );
+    const tripoint_abs_ms near = origin + tripoint( 8, -3, 0 );
+    const tripoint_abs_ms far = origin + tripoint( -40, 30, 0 );
+    const tripoint_abs_ms above = origin + tripoint( 2, 2, 1 );
+    create_tile_zone( "Near", zone_type_LOOT_FOOD, near );
+    create_tile_zone( "Far", zone_type_LOOT_FOOD, far );
+    create_tile_zone( "Above", zone_type_LOOT_FOOD, above );
+
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin, 7 ) == std::unordered_set<tripoint_abs_ms> { above } );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin, 8 ) ==
+           std::unordered_set<tripoint_abs_ms> { near, above } );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin, 40 ).size() == 3 );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, origin, 1000000 ).size() == 3 );
+    CHECK( zm.get_near( zone_type_LOOT_DRINK, origin, 40 ).empty() );
+
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_FOOD, origin, 1 ) );
+    CHECK( zm.has_near( zone_type_LOOT_FOOD, far, 0 ) );
+    CHECK( zm.has( zone_type_LOOT_FOOD, near ) );
+    CHECK_FALSE( zm.has( zone_type_LOOT_FOOD, origin ) );
+
+    CHECK( zm.get_nearest( zone_type_LOOT_FOOD, origin, 100 ) == above );
+    CHECK( zm.get_nearest( zone_type_LOOT_FOOD, far + tripoint::south, 100 ) == far );
+    CHECK_FALSE( zm.get_nearest( zone_type_LOOT_FOOD, origin, 1 ).has_value() );
+}
+
 TEST_CASE( "zone_sorting_comestibles_", "[zones][items][food][activities]" )
 {
     clear_map();
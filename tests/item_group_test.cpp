@@ -1,10 +1,13 @@
 #include <algorithm>
 #include <list>
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "calendar.h"
 #include "cata_catch.h"
 #include "cata_utility.h"
 #include "enums.h"
@@ -269,3 +272,48 @@ TEST_CASE( "Event-based_item_spawns_do_not_spawn_outside_event", "[item_group]"
         CHECK( items[0].typeId() == test_rock );
     }
 }
+
+TEST_CASE( "distribution_spawns_follow_entry_weights", "[item_group]" )
+{
+    override_option ev_spawn_opt( "EVENT_SPAWNS", "off" );
+    Item_group group( Item_group::G_DISTRIBUTION, 100, 0, 0, "distribution test" );
+    group.add_item_entry( itype_rock, 10 );
+    // Inactive event entries pass their weight on to the next entry, or to nothing at the end
+    group.add_entry( std::make_unique<Single_item_creator>( itype_test_rock.str(),
+                     Single_item_creator::S_ITEM, 30, "event entry", holiday::christmas ) );
+    group.add_item_entry( itype_match, 20 );
+    group.add_entry( std::make_unique<Single_item_creator>( itype_test_rock.str(),
+                     Single_item_creator::S_ITEM, 40, "trailing event entry", holiday::halloween ) );
+    group.finalize();
+
+    const int spawns = 10000;
+    std::map<itype_id, int> counts;
+    for( int i = 0; i < spawns; i++ ) {
+        Item_spawn_data::ItemList list;
+        Item_spawn_data::RecursionList rec;
+        group.create( list, calendar::turn, rec, spawn_flags::none );
+        REQUIRE( list.size() <= 1 );
+        if( !list.empty() ) {
+            counts[list.front().typeId()]++;
+        }
+    }
+    CAPTURE( counts );
+    CHECK( counts[itype_test_rock] == 0 );
+    CHECK( counts[itype_rock] == Approx( spawns * 0.1 ).margin( spawns * 0.015 ) );
+    CHECK( counts[itype_match] == Approx( spawns * 0.5 ).margin( spawns * 0.025 ) );
+}
+
+TEST_CASE( "item_group_spawn_benchmark", "[.][item_group][benchmark]" )
+{
+    const item_group_id clothes( "allclothes" );
+    const item_group_id pistols( "guns_pistol_common" );
+
+    BENCHMARK( "spawn 100 from distributions" ) {
+        size_t spawned = 0;
+        for( int i = 0; i < 50; i++ ) {
+            spawned += item_group::items_from( clothes ).size();
+            spawned += item_group::items_from( pistols ).size();
+        }
+        return spawned;
+    };
+}
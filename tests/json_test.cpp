@@ -25,6 +25,7 @@
 #include "json_loader.h"
 #include "magic.h"
 #include "mutation.h"
+#include "path_info.h"
 #include "sounds.h"
 #include "string_formatter.h"
 #include "translations.h"
@@ -981,3 +982,22 @@ TEST_CASE( "serialize_optional", "[json]" )
         test_serialization( v, "[1,2,3]" );
     }
 }
+
+TEST_CASE( "json_loader_from_paths_keeps_file_order", "[json]" )
+{
+    const std::vector<cata_path> files = {
+        PATH_INFO::jsondir() / "achievements.json",
+        PATH_INFO::jsondir() / "no_such_file.json",
+        PATH_INFO::jsondir() / "anatomy.json"
+    };
+    std::vector<json_loader::file_result> parsed = json_loader::from_paths( files );
+    REQUIRE( parsed.size() == files.size() );
+
+    for( size_t i : { 0, 2 } ) {
+        JsonValue jv = std::move( parsed[i] ).get();
+        CHECK( jv.test_array() );
+        const JsonValue expected = json_loader::from_path( files[i] );
+        CHECK( jv.get_array().size() == expected.get_array().size() );
+    }
+    CHECK_THROWS_AS( std::move( parsed[1] ).get(), JsonError );
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -110,6 +111,34 @@ TEST_CASE( "Gaining_losing_limbs", "[limb]" )
     REQUIRE( !dude.has_part( body_part_head ) );
 }
 
+TEST_CASE( "bodypart_flat_map_keeps_parts_ordered_by_id", "[limb]" )
+{
+    std::vector<bodypart_str_id> ids = { body_part_arm_l, body_part_head };
+    std::sort( ids.begin(), ids.end() );
+    bodypart_flat_map body;
+    body.assign( ids );
+    body[body_part_head].set_hp_cur( 5 );
+    REQUIRE( body.emplace( body_part_test_lizard_tail, bodypart( body_part_test_lizard_tail ) ).second );
+    CHECK_FALSE( body.emplace( body_part_head, bodypart( body_part_head ) ).second );
+    body[body_part_torso].set_hp_cur( 7 );
+
+    REQUIRE( body.size() == 4 );
+    CHECK( std::is_sorted( body.begin(), body.end(), []( const auto & lhs, const auto & rhs ) {
+        return lhs.first < rhs.first;
+    } ) );
+    CHECK( body.find( body_part_head )->second.get_hp_cur() == 5 );
+    CHECK( body.find( body_part_torso )->second.get_hp_cur() == 7 );
+    CHECK( body.count( body_part_leg_l ) == 0 );
+
+    bodypart_flat_map copy;
+    copy = body;
+    copy.erase( copy.find( body_part_head ) );
+    CHECK( copy.size() == 3 );
+    CHECK( copy.find( body_part_head ) == copy.end() );
+    CHECK( copy.find( body_part_torso )->second.get_hp_cur() == 7 );
+    CHECK( body.count( body_part_head ) == 1 );
+}
+
 TEST_CASE( "limb_conditional_flags", "[character][encumbrance][limb]" )
 {
     standard_npc dude( "Test NPC" );
@@ -435,3 +435,50 @@ TEST_CASE( "math_parser_dialogue_integration", "[math_parser]" )
     CHECK( get_avatar().get_stamina() == 459 );
 
 }
+
+TEST_CASE( "math_parser_compiled_matches_tree", "[math_parser]" )
+{
+    dialogue d( std::make_unique<talker>(), std::make_unique<talker>() );
+    math_exp testexp;
+
+    // constant subexpressions are folded, variable ones are not
+    CHECK( testexp.parse( "2 * 3 + _x * ( 1 + 1 )" ) );
+    d.set_value( "x", 5.0 );
+    CHECK( testexp.eval( d ) == Approx( 16 ) );
+    d.set_value( "x", -1.0 );
+    CHECK( testexp.eval( d ) == Approx( 4 ) );
+
+    // ternaries with variable and constant conditions
+    CHECK( testexp.parse( "_x > 0 ? _x * 2 : ( 1 > 0 ? 7 : 8 )" ) );
+    CHECK( testexp.eval( d ) == Approx( 7 ) );
+    d.set_value( "x", 3.0 );
+    CHECK( testexp.eval( d ) == Approx( 6 ) );
+
+    // the compiled program survives copies of the expression
+    math_exp copied( testexp );
+    testexp = math_exp();
+    CHECK( copied.eval( d ) == Approx( 6 ) );
+
+    // impure functions are not folded
+    CHECK( testexp.parse( "rng( 0, 1000000 ) + rng( 0, 1000000 )" ) );
+    bool differs = false;
+    const double first = testexp.eval( d );
+    for( int i = 0; i < 10 && !differs; i++ ) {
+        differs = testexp.eval( d ) != first;
+    }
+    CHECK( differs );
+}
+
+TEST_CASE( "math_parser_benchmark", "[.][math_parser][benchmark]" )
+{
+    dialogue d( std::make_unique<talker>(), std::make_unique<talker>() );
+    math_exp testexp;
+    d.set_value( "x", 4.0 );
+    d.set_value( "y", 2.5 );
+    REQUIRE( testexp.parse(
+                 "_x > 3 ? max( _x * _y, sqrt( 16 ) + 2 ^ 3 ) : min( _y, ( 5 + 7 ) * 7.123 - 3 ) + abs( _x - _y )" ) );
+
+    BENCHMARK( "mixed expression" ) {
+        return testexp.eval( d );
+    };
+}
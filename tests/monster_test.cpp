@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -725,3 +726,62 @@ TEST_CASE( "monsters_spawn_baby_groups", "[monster][reproduction]" )
     CAPTURE( amount_of_iteration );
     CHECK( test_monster_spawns_baby_mongroup );
 }
+
+static std::set<const monster *> monsters_near( const tripoint_abs_ms &center, int radius )
+{
+    std::set<const monster *> found;
+    get_creature_tracker().for_each_monster_near( center, radius, [&found]( monster & critter ) {
+        found.insert( &critter );
+    } );
+    return found;
+}
+
+static std::set<const monster *> monsters_near_brute_force( const tripoint_abs_ms &center,
+        int radius )
+{
+    std::set<const monster *> found;
+    for( const monster &critter : g->all_monsters() ) {
+        if( square_dist( critter.pos_abs().xy(), center.xy() ) <= radius ) {
+            found.insert( &critter );
+        }
+    }
+    return found;
+}
+
+TEST_CASE( "monsters_near_follow_monster_moves", "[monster]" )
+{
+    clear_map();
+    clear_creatures();
+    map &here = get_map();
+    const tripoint_bub_ms origin = get_avatar().pos_bub();
+    // Spread over several submaps, either side of submap borders
+    std::vector<monster *> monsters;
+    for( const point &offset : {
+             point( 1, 0 ), point( 11, 0 ), point( 12, 3 ), point( -13, -7 ), point( 30, 30 )
+         } ) {
+        monsters.push_back( &spawn_test_monster( "mon_zombie", origin + offset ) );
+    }
+    const tripoint_abs_ms center = here.get_abs( origin );
+
+    for( const int radius : { 0, 1, 5, 12, 20, 60 } ) {
+        CAPTURE( radius );
+        CHECK( monsters_near( center, radius ) == monsters_near_brute_force( center, radius ) );
+    }
+
+    // Moving across submaps keeps the monster findable where it is now
+    monster &mover = *monsters.front();
+    mover.setpos( here, origin + tripoint( 25, -20, 0 ) );
+    CHECK( monsters_near( center, 20 ) == monsters_near_brute_force( center, 20 ) );
+    CHECK( monsters_near( mover.pos_abs(), 0 ).count( &mover ) == 1 );
+
+    // Swapped monsters are found at each others places
+    get_creature_tracker().swap_positions( *monsters[1], *monsters[3] );
+    CHECK( monsters_near( monsters[1]->pos_abs(), 0 ).count( monsters[1] ) == 1 );
+    CHECK( monsters_near( monsters[3]->pos_abs(), 0 ).count( monsters[3] ) == 1 );
+
+    // Dead monsters are not visited
+    monsters[2]->die( &here, nullptr );
+    CHECK( monsters_near( center, 60 ).count( monsters[2] ) == 0 );
+    get_creature_tracker().remove_dead();
+    CHECK( monsters_near( center, 60 ) == monsters_near_brute_force( center, 60 ) );
+}
@@ -1,15 +1,25 @@
 #include <string>
+#include <vector>
 
 #include "calendar.h"
 #include "cata_catch.h"
+#include "character.h"
 #include "coordinates.h"
+#include "creature.h"
+#include "creature_tracker.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "monster.h"
+#include "player_helpers.h"
 #include "point.h"
+#include "rng.h"
 #include "type_id.h"
 
+static const efftype_id effect_invisibility( "invisibility" );
+static const efftype_id effect_no_sight( "no_sight" );
+
 static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_wall( "t_wall" );
 
 static monster &spawn_and_clear( const tripoint_bub_ms &pos, bool set_floor )
 {
@@ -74,3 +84,70 @@ TEST_CASE( "monsters_should_not_see_through_floors", "[vision]" )
     CHECK( sky.sees( here, distant ) );
     CHECK( distant.sees( here, sky ) );
 }
+
+TEST_CASE( "remembered_visibility_matches_uncached_sees", "[vision]" )
+{
+    map &here = get_map();
+    creature_tracker &creatures = get_creature_tracker();
+
+    clear_map( -2, 1 );
+    clear_avatar();
+    set_time( midday );
+    Character &you = get_player_character();
+    const tripoint_bub_ms center = you.pos_bub();
+
+    std::vector<Creature *> critters = { &you };
+    for( int i = 0; i < 6; i++ ) {
+        critters.push_back( &spawn_test_monster( "mon_zombie", center + tripoint( 2 * i - 5, 4, 0 ) ) );
+    }
+    const auto random_point = [&center]() {
+        return center + tripoint( rng( -8, 8 ), rng( -8, 8 ), 0 );
+    };
+
+    for( int round = 0; round < 200; round++ ) {
+        switch( rng( 0, 4 ) ) {
+            case 0: {
+                // Move a monster, which must be picked up without invalidating anything
+                Creature &critter = *random_entry( critters );
+                const tripoint_bub_ms dest = random_point();
+                if( !critter.is_avatar() && creatures.creature_at( dest ) == nullptr &&
+                    here.ter( dest ) == ter_t_floor ) {
+                    critter.setpos( here, dest );
+                }
+                break;
+            }
+            case 1: {
+                Creature &critter = *random_entry( critters );
+                const efftype_id &eff = one_in( 2 ) ? effect_invisibility : effect_no_sight;
+                if( critter.has_effect( eff ) ) {
+                    critter.remove_effect( eff );
+                } else {
+                    critter.add_effect( eff, 1_hours );
+                }
+                break;
+            }
+            case 2: {
+                const tripoint_bub_ms p = random_point();
+                if( creatures.creature_at( p ) == nullptr ) {
+                    here.ter_set( p, here.ter( p ) == ter_t_wall ? ter_t_floor : ter_t_wall );
+                    here.build_map_cache( p.z() );
+                }
+                break;
+            }
+            case 3:
+                set_time( calendar::turn + rng( 1, 12 ) * 1_hours );
+                break;
+            default:
+                // Nothing changed, everything is answered from memory
+                break;
+        }
+
+        for( const Creature *observer : critters ) {
+            for( const Creature *target : critters ) {
+                CAPTURE( round, observer->get_name(), observer->pos_bub().to_string(),
+                         target->get_name(), target->pos_bub().to_string() );
+                CHECK( observer->sees( here, *target ) == observer->sees_uncached( here, *target ) );
+            }
+        }
+    }
+}
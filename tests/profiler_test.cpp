@@ -0,0 +1,60 @@
+#include <map>
+#include <string>
+#include <thread>
+
+#include "cata_catch.h"
+#include "cata_path.h"
+#include "cata_utility.h"
+#include "filesystem.h"
+#include "flexbuffer_json.h"
+#include "path_info.h"
+#include "perf.h"
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#include "mingw.thread.h"
+#endif
+
+TEST_CASE( "profiler_capture_writes_chrome_trace", "[nogame]" )
+{
+    const cata_path trace_path = PATH_INFO::config_dir_path() / "profiler_test_trace.json";
+    REQUIRE_FALSE( cata_profiler::capturing() );
+    {
+        CATA_PROFILE_ZONE( "before capture", "test" );
+    }
+
+    cata_profiler::start_capture( trace_path );
+    CHECK( cata_profiler::capturing() );
+    {
+        CATA_PROFILE_ZONE( "outer", "test" );
+        {
+            CATA_PROFILE_ZONE( "inner", "test" );
+        }
+    }
+    std::thread worker( []() {
+        CATA_PROFILE_ZONE( "worker", "test" );
+    } );
+    worker.join();
+    REQUIRE( cata_profiler::stop_capture() );
+    CHECK_FALSE( cata_profiler::capturing() );
+    CHECK_FALSE( cata_profiler::stop_capture() );
+
+    std::map<std::string, int> zones;
+    std::map<std::string, int> zone_tids;
+    REQUIRE( read_from_file_json( trace_path, [&]( const JsonValue & jv ) {
+        JsonObject jo = jv;
+        jo.allow_omitted_members();
+        for( JsonObject event : jo.get_array( "traceEvents" ) ) {
+            event.allow_omitted_members();
+            CHECK( event.get_string( "cat" ) == "test" );
+            CHECK( event.get_string( "ph" ) == "X" );
+            CHECK( event.get_int( "dur" ) >= 0 );
+            zones[event.get_string( "name" )]++;
+            zone_tids[event.get_string( "name" )] = event.get_int( "tid" );
+        }
+    } ) );
+    remove_file( trace_path );
+
+    CHECK( zones == std::map<std::string, int> { { "inner", 1 }, { "outer", 1 }, { "worker", 1 } } );
+    CHECK( zone_tids["inner"] == zone_tids["outer"] );
+    CHECK( zone_tids["worker"] != zone_tids["outer"] );
+}
@@ -0,0 +1,65 @@
+#include <string>
+
+#include "cata_catch.h"
+#include "character.h"
+#include "coordinates.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_scale_constants.h"
+#include "monster.h"
+#include "options_helpers.h"
+#include "point.h"
+#include "sounds.h"
+#include "weather_type.h"
+
+static const std::string mon_zombie_str( "mon_zombie" );
+
+TEST_CASE( "sounds_reach_only_monsters_in_range", "[sounds][monster]" )
+{
+    clear_map();
+    clear_creatures();
+    scoped_weather_override weather_clear( WEATHER_CLEAR );
+    sounds::reset_sounds();
+
+    const tripoint_bub_ms source( 60, 60, 0 );
+    monster &near = spawn_test_monster( mon_zombie_str, source + point( 5, 0 ) );
+    monster &other_submap = spawn_test_monster( mon_zombie_str, source + point( -13, 14 ) );
+    monster &far = spawn_test_monster( mon_zombie_str, source + point( 45, 0 ) );
+    REQUIRE( near.wandf == 0 );
+    REQUIRE( other_submap.wandf == 0 );
+    REQUIRE( far.wandf == 0 );
+
+    sounds::sound( source, 20, sounds::sound_t::combat, "BOOM" );
+    sounds::process_sounds();
+
+    CHECK( near.wandf > 0 );
+    CHECK( other_submap.wandf > 0 );
+    CHECK( far.wandf == 0 );
+}
+
+TEST_CASE( "process_sounds_benchmark", "[.][sounds][benchmark]" )
+{
+    clear_map();
+    clear_creatures();
+    scoped_weather_override weather_clear( WEATHER_CLEAR );
+    sounds::reset_sounds();
+
+    // 500 listeners spread over the reality bubble.
+    const tripoint_bub_ms player_pos = get_player_character().pos_bub();
+    for( int i = 0; i < 500; i++ ) {
+        const tripoint_bub_ms p( 2 + ( i % 25 ) * 5, 2 + ( i / 25 ) * 6, 0 );
+        if( p != player_pos ) {
+            spawn_test_monster( mon_zombie_str, p );
+        }
+    }
+
+    BENCHMARK( "50 sound sources" ) {
+        for( int i = 0; i < 50; i++ ) {
+            sounds::sound( tripoint_bub_ms( 3 + ( i * 37 ) % ( MAPSIZE_X - 6 ),
+                                            3 + ( i * 53 ) % ( MAPSIZE_Y - 6 ), 0 ),
+                           10 + i % 30, sounds::sound_t::combat, "BANG" );
+        }
+        sounds::process_sounds();
+        return 0;
+    };
+}
@@ -0,0 +1,137 @@
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "point.h"
+#include "submap_view.h"
+#include "type_id.h"
+
+static const furn_str_id furn_f_plant_seed( "f_plant_seed" );
+
+static const itype_id itype_seed_wheat( "seed_wheat" );
+
+static const ter_str_id ter_t_dirt( "t_dirt" );
+static const ter_str_id ter_t_dirtmound( "t_dirtmound" );
+
+// An overmap terrain tile well outside of the reality bubble
+static tripoint_abs_omt remote_omt()
+{
+    const tripoint_abs_omt bubble_corner =
+        project_to<coords::omt>( get_map().get_abs( tripoint_bub_ms( 0, 0, 0 ) ) );
+    return bubble_corner + point_rel_omt( 12, 3 );
+}
+
+TEST_CASE( "submap_view_changes_submaps_away_from_the_bubble", "[map]" )
+{
+    clear_map();
+    const tripoint_abs_omt omt = remote_omt();
+    const tripoint_omt_ms p( 13, 5, omt.z() );
+    REQUIRE_FALSE( get_map().inbounds( project_to<coords::ms>( omt ) ) );
+
+    submap_view view;
+    view.load( omt );
+    view.i_clear( p );
+    view.set( p, ter_t_dirtmound, furn_str_id::NULL_ID() );
+    CHECK( view.ter( p ) == ter_t_dirtmound );
+    CHECK_FALSE( view.has_furn( p ) );
+
+    item seed( itype_seed_wheat );
+    CHECK( view.add_item_or_charges( p, seed ) );
+    CHECK( view.add_item_or_charges( p, seed ) );
+    REQUIRE( view.i_at( p ).size() == ( seed.count_by_charges() ? 1 : 2 ) );
+
+    // Planting turns the mound into dirt, like it does on the map
+    CHECK( view.furn_set( p, furn_f_plant_seed ) );
+    CHECK( view.ter( p ) == ter_t_dirt );
+    CHECK( view.furn( p ) == furn_f_plant_seed );
+    // Plants hold no more items
+    CHECK_FALSE( view.add_item_or_charges( p, seed ) );
+    view.save();
+
+    // Another view, and a tinymap, see the same submaps
+    submap_view other;
+    other.load( omt );
+    CHECK( other.furn( p ) == furn_f_plant_seed );
+    CHECK( other.i_at( p ).size() == view.i_at( p ).size() );
+    tinymap tm;
+    tm.load( omt, false );
+    CHECK( tm.ter( p ) == ter_t_dirt );
+    CHECK( tm.furn( p ) == furn_f_plant_seed );
+
+    other.i_clear( p );
+    CHECK( view.i_at( p ).empty() );
+
+    // Points outside of the OMT or on other z-levels are not part of the view
+    CHECK_FALSE( view.inbounds( tripoint_omt_ms( 24, 0, omt.z() ) ) );
+    CHECK_FALSE( view.inbounds( tripoint_omt_ms( 0, 0, omt.z() + 1 ) ) );
+    CHECK_FALSE( view.ter_set( tripoint_omt_ms( -1, 0, omt.z() ), ter_t_dirt ) );
+}
+
+TEST_CASE( "submap_view_changes_the_bubble_through_the_map", "[map]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms center( 60, 60, 0 );
+    const tripoint_abs_omt omt = project_to<coords::omt>( here.get_abs( center ) );
+    const tripoint_omt_ms p( 3, 4, omt.z() );
+
+    submap_view view;
+    view.load( omt );
+    const tripoint_bub_ms p_bub = here.get_bub( view.get_abs( p ) );
+    REQUIRE( here.inbounds( p_bub ) );
+    CHECK( view.ter( p ) == here.ter( p_bub ) );
+
+    view.set( p, ter_t_dirtmound, furn_str_id::NULL_ID() );
+    CHECK( here.ter( p_bub ) == ter_t_dirtmound );
+    view.furn_set( p, furn_f_plant_seed );
+    CHECK( here.ter( p_bub ) == ter_t_dirt );
+    CHECK( here.furn( p_bub ) == furn_f_plant_seed );
+}
+
+// The scan camp farm operations do for each expansion whenever the camp menu is shown
+template<typename Map>
+static int count_unplanted_mounds( Map &farm_map, const tripoint_abs_omt &omt )
+{
+    int plots = 0;
+    for( int x = 0; x < 2 * SEEX; x++ ) {
+        for( int y = 0; y < 2 * SEEY; y++ ) {
+            const tripoint_omt_ms p( x, y, omt.z() );
+            if( farm_map.ter( p ) == ter_t_dirtmound && !farm_map.has_furn( p ) ) {
+                plots++;
+            }
+        }
+    }
+    return plots;
+}
+
+TEST_CASE( "camp_farm_map_benchmark", "[.][camp][map][benchmark]" )
+{
+    clear_map();
+    const tripoint_abs_omt omt = remote_omt();
+    {
+        submap_view farm;
+        farm.load( omt );
+        for( int x = 0; x < 2 * SEEX; x += 2 ) {
+            farm.set( tripoint_omt_ms( x, 7, omt.z() ), ter_t_dirtmound, furn_str_id::NULL_ID() );
+        }
+        farm.save();
+    }
+
+    BENCHMARK( "smallmap" ) {
+        smallmap farm;
+        farm.load( omt, false );
+        return count_unplanted_mounds( farm, omt );
+    };
+    BENCHMARK( "tinymap" ) {
+        tinymap farm;
+        farm.load( omt, false );
+        return count_unplanted_mounds( farm, omt );
+    };
+    BENCHMARK( "submap_view" ) {
+        submap_view farm;
+        farm.load( omt );
+        return count_unplanted_mounds( farm, omt );
+    };
+}
@@ -8,7 +8,9 @@
 #include <cstdio>
 #include <cstdlib>
 #include <exception>
+#include <fstream>
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -21,6 +23,9 @@
 #else
 #include <unistd.h>
 #endif
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#endif
 
 #include "cata_catch.h"
 
@@ -69,6 +74,10 @@ static bool error_during_initialization{ false };
 static bool fail_to_init_game_state{ false };
 
 static bool needs_game{ false };
+// Set when the game state was loaded before the Catch session, see run_test_shards.
+static bool game_state_preloaded{ false };
+// Totals of the last Catch session, which test shards pass on to the parent process.
+static Catch::Totals session_totals;
 
 static std::vector<mod_id> extract_mod_selection( const std::string_view mod_string )
 {
@@ -202,7 +211,9 @@ struct CataListener : Catch::TestEventListenerBase {
     using TestEventListenerBase::TestEventListenerBase;
 
     void testRunStarting( Catch::TestRunInfo const & ) override {
-        if( needs_game ) {
+        if( game_state_preloaded ) {
+            DebugLog( D_INFO, DC_ALL ) << "Running Catch2 session on preloaded game data:" << std::endl;
+        } else if( needs_game ) {
             try {
                 init_global_game_state( mods, option_overrides_for_test_suite, user_dir );
             } catch( ... ) {
@@ -221,8 +232,10 @@ struct CataListener : Catch::TestEventListenerBase {
         end_time = start_time = std::chrono::system_clock::now();
     }
 
-    void testRunEnded( Catch::TestRunStats const & ) override {
+    void testRunEnded( Catch::TestRunStats const &testRunStats ) override {
         end_time = std::chrono::system_clock::now();
+        // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
+        session_totals = testRunStats.totals;
     }
 
     void sectionStarting( Catch::SectionInfo const &sectionInfo ) override {
@@ -295,6 +308,149 @@ struct CataCIReporter: Catch::ConsoleReporter {
 
 CATCH_REGISTER_REPORTER( "cata-ci-reporter", CataCIReporter )
 
+#if !defined(_WIN32)
+// Quotes a test case name for a Catch test spec, the way --input-file does.
+static std::string quote_test_name( const std::string &name )
+{
+    std::string quoted = "\"";
+    for( const char c : name ) {
+        if( c == '\\' || c == '"' ) {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+static void write_totals( const std::string &path, const Catch::Totals &totals )
+{
+    std::ofstream out( path );
+    out << totals.testCases.passed << ' ' << totals.testCases.failed << ' '
+        << totals.testCases.failedButOk << ' ' << totals.assertions.passed << ' '
+        << totals.assertions.failed << ' ' << totals.assertions.failedButOk << '\n';
+}
+
+static bool read_totals( const std::string &path, Catch::Totals &totals )
+{
+    std::ifstream in( path );
+    return static_cast<bool>( in >> totals.testCases.passed >> totals.testCases.failed
+                              >> totals.testCases.failedButOk >> totals.assertions.passed
+                              >> totals.assertions.failed >> totals.assertions.failedButOk );
+}
+
+// Loads the game data once, then forks shard_count children that each run every
+// shard_count-th of the selected test cases. The children write their console reports
+// and their totals to files. Once all of them are done, the reports are printed in
+// shard order, followed by the totals of all shards together.
+static int run_test_shards( Catch::Session &session, int shard_count )
+{
+    using namespace Catch;
+    std::vector<TestCase> const &tcs = filterTests( getAllTestCasesSorted( session.config() ),
+                                       session.config().testSpec(), session.config() );
+
+    if( needs_game ) {
+        try {
+            init_global_game_state( mods, option_overrides_for_test_suite, user_dir );
+        } catch( ... ) {
+            DebugLog( D_INFO, DC_ALL ) << "Fail to initialize global game state" << std::endl;
+            // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
+            fail_to_init_game_state = true;
+            throw;
+        }
+        // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
+        error_during_initialization = debug_has_error_been_observed();
+        // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
+        game_state_preloaded = true;
+        DebugLog( D_INFO, DC_ALL ) << "Game data loaded, forking " << shard_count << " shards" << std::endl;
+    }
+    std::cout.flush();
+    std::cerr.flush();
+    fflush( stdout );
+    fflush( stderr );
+
+    // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
+    start_time = std::chrono::system_clock::now();
+    std::vector<std::pair<pid_t, std::string>> shards;
+    bool fork_failed = false;
+    for( int shard = 0; shard < shard_count; ++shard ) {
+        std::vector<std::string> tests_or_tags;
+        for( size_t i = shard; i < tcs.size(); i += shard_count ) {
+            if( !tests_or_tags.empty() ) {
+                tests_or_tags.emplace_back( "," );
+            }
+            tests_or_tags.push_back( quote_test_name( tcs[i].name ) );
+        }
+        if( tests_or_tags.empty() ) {
+            continue;
+        }
+        const std::string report = string_format( "%sshard_%d.txt", user_dir, shard );
+        const pid_t pid = fork();
+        if( pid < 0 ) {
+            // The tests of this and the remaining shards don't run, so the run fails.
+            DebugLog( D_ERROR, DC_ALL ) << "Failed to fork test shard " << shard
+                                        << ", its tests and those of the later shards were not run";
+            fork_failed = true;
+            break;
+        }
+        if( pid == 0 ) {
+            ConfigData config = session.configData();
+            config.testsOrTags = tests_or_tags;
+            config.outputFilename = report;
+            session.useConfigData( config );
+            int result = session.run();
+            if( result == 0 && debug_has_error_been_observed() && !error_during_initialization ) {
+                DebugLog( D_INFO, DC_ALL ) << "Treating result as failure due to error logged during tests.";
+                result = 1;
+            }
+            write_totals( report + ".totals", session_totals );
+            // Close the report file, then leave without tearing down the shared game state.
+            session.useConfigData( ConfigData() );
+            fflush( stdout );
+            fflush( stderr );
+            _exit( result );
+        }
+        shards.emplace_back( pid, report );
+    }
+
+    int result = fork_failed ? 1 : 0;
+    for( const std::pair<pid_t, std::string> &shard : shards ) {
+        int status = 0;
+        if( waitpid( shard.first, &status, 0 ) < 0 || !WIFEXITED( status ) ) {
+            DebugLog( D_ERROR, DC_ALL ) << "Test shard " << shard.first << " did not exit normally";
+            result = std::max( result, 1 );
+        } else {
+            result = std::min( result + WEXITSTATUS( status ), 255 );
+        }
+    }
+    // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
+    end_time = std::chrono::system_clock::now();
+    Totals totals;
+    for( const std::pair<pid_t, std::string> &shard : shards ) {
+        std::ifstream report( shard.second );
+        std::cout << report.rdbuf();
+        report.close();
+        remove_file( shard.second );
+        Totals shard_totals;
+        if( read_totals( shard.second + ".totals", shard_totals ) ) {
+            totals += shard_totals;
+        } else {
+            DebugLog( D_ERROR, DC_ALL ) << "Test shard " << shard.first << " left no totals";
+            result = std::max( result, 1 );
+        }
+        remove_file( shard.second + ".totals" );
+    }
+    std::cout << string_format( "All %d shards: test cases: %d | %d passed | %d failed | %d failed as expected\n",
+                                shards.size(), totals.testCases.total(), totals.testCases.passed,
+                                totals.testCases.failed, totals.testCases.failedButOk );
+    std::cout << string_format( "All %d shards: assertions: %d | %d passed | %d failed | %d failed as expected\n",
+                                shards.size(), totals.assertions.total(), totals.assertions.passed,
+                                totals.assertions.failed, totals.assertions.failedButOk );
+    std::cout.flush();
+    return result;
+}
+#endif
+
+
 int main( int argc, const char *argv[] )
 {
 #if defined(_MSC_VER)
@@ -324,6 +480,7 @@ int main( int argc, const char *argv[] )
     std::string mods_string;
     std::string check_plural_str;
     int limit_debug_level = -1;
+    int fork_shards = 0;
     Parser cli = session.cli()
                  | Opt( mods_string, "mod1,mod2,…" )
                  ["--mods"]
@@ -346,6 +503,9 @@ int main( int argc, const char *argv[] )
                  | Opt( limit_debug_level, "number" )
                  ["--set-debug-level-mask"]
                  ( "[CataclysmDDA] Set debug level bitmask - see `enum DebugLevel` in src/debug.h for individual bits definition" )
+                 | Opt( fork_shards, "count" )
+                 ["--fork-shards"]
+                 ( "[CataclysmDDA] Load the game data once, then run the tests in this many forked processes (not on Windows)." )
                  ;
     session.cli( cli );
 
@@ -370,6 +530,17 @@ int main( int argc, const char *argv[] )
 
     option_overrides_for_test_suite = extract_option_overrides( option_overrides );
 
+    if( fork_shards > 1 ) {
+        // The reports of the shards are printed one after another, which only works for
+        // reports meant to be read.
+        const std::string &reporter = session.configData().reporterName;
+        if( ( reporter != "console" && reporter != "cata-ci-reporter" ) ||
+            !session.configData().outputFilename.empty() ) {
+            printf( "--fork-shards only supports the console reporters writing to stdout" );
+            return EXIT_FAILURE;
+        }
+    }
+
     if( error_fmt == "github-action" ) {
         // NOLINTNEXTLINE(cata-tests-must-restore-global-state)
         error_log_format = error_log_format_t::github_action;
@@ -444,8 +615,21 @@ int main( int argc, const char *argv[] )
         }
     }
 
+    bool sharded = false;
     try {
+#if !defined(_WIN32)
+        if( fork_shards > 1 ) {
+            sharded = true;
+            result = run_test_shards( session, fork_shards );
+        } else {
+            result = session.run();
+        }
+#else
+        if( fork_shards > 1 ) {
+            DebugLog( D_WARNING, DC_ALL ) << "--fork-shards is not supported on Windows, running in one process";
+        }
         result = session.run();
+#endif
     } catch( const std::exception &err ) {
         DebugLog( D_ERROR, DC_ALL ) << "Terminated:\n" << err.what();
         DebugLog( D_INFO, DC_ALL ) <<
@@ -457,6 +641,11 @@ int main( int argc, const char *argv[] )
         std::string world_name = world_generator->active_world->world_name;
         if( result == 0 || dont_save || fail_to_init_game_state ) {
             world_generator->delete_world( world_name, true );
+        } else if( sharded ) {
+            // The tests ran in the shards, this process only has the world as it was before.
+            world_generator->delete_world( world_name, true );
+            DebugLog( D_INFO, DC_ALL ) << "Test world " << world_name <<
+                                       " not kept with --fork-shards, run the failed tests without it to inspect their world.";
         } else {
             if( g->save() ) {
                 DebugLog( D_INFO, DC_ALL ) << "Test world " << world_name << " left for inspection.";
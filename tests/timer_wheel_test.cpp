@@ -0,0 +1,69 @@
+#include <vector>
+
+#include "cata_catch.h"
+#include "timer_wheel.h"
+
+TEST_CASE( "timer_wheel_expires_entries_in_time_order", "[timer_wheel][nogame]" )
+{
+    timer_wheel<int> wheel;
+    // Spread over every level of the wheel and the overflow list
+    const std::vector<int> times = { 3, 1, 70, 70, 5000, 300000, 20000000, 1 };
+    for( size_t i = 0; i < times.size(); i++ ) {
+        wheel.insert( times[i], static_cast<int>( i ) );
+    }
+    CHECK( wheel.size() == times.size() );
+
+    std::vector<int> out;
+    wheel.expire( 0, out );
+    CHECK( out.empty() );
+    wheel.expire( 3, out );
+    CHECK( out == std::vector<int> { 1, 7, 0 } );
+    out.clear();
+    for( int turn = 4; turn <= 100; turn++ ) {
+        wheel.expire( turn, out );
+    }
+    CHECK( out == std::vector<int> { 2, 3 } );
+    out.clear();
+    wheel.expire( 299999, out );
+    CHECK( out == std::vector<int> { 4 } );
+    out.clear();
+    wheel.expire( 300000, out );
+    CHECK( out == std::vector<int> { 5 } );
+    out.clear();
+    wheel.expire( 30000000, out );
+    CHECK( out == std::vector<int> { 6 } );
+    CHECK( wheel.empty() );
+}
+
+TEST_CASE( "timer_wheel_handles_past_entries_and_time_going_back", "[timer_wheel][nogame]" )
+{
+    timer_wheel<int> wheel;
+    std::vector<int> out;
+    wheel.expire( 1000, out );
+    // Entries at or before the current turn are due at once
+    wheel.insert( 900, 1 );
+    wheel.insert( 1000, 2 );
+    wheel.insert( 1010, 3 );
+    wheel.expire( 1000, out );
+    CHECK( out == std::vector<int> { 1, 2 } );
+    out.clear();
+
+    wheel.expire( 10, out );
+    CHECK( out.empty() );
+    wheel.insert( 20, 4 );
+    for( int turn = 11; turn <= 1010; turn++ ) {
+        wheel.expire( turn, out );
+    }
+    CHECK( out == std::vector<int> { 4, 3 } );
+
+    wheel.insert( 5000, 5 );
+    int visited = 0;
+    wheel.for_each( [&visited]( int time, int value ) {
+        CHECK( time == 5000 );
+        CHECK( value == 5 );
+        visited++;
+    } );
+    CHECK( visited == 1 );
+    wheel.clear();
+    CHECK( wheel.empty() );
+}
@@ -0,0 +1,44 @@
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "vehicle_part_grid.h"
+
+TEST_CASE( "vehicle_part_grid_keeps_parts_sorted_per_mount", "[vehicle][nogame]" )
+{
+    vehicle_part_grid grid;
+    const point_rel_ms a( 0, 0 );
+    const point_rel_ms b( -2, 3 );
+    const std::vector<std::pair<point_rel_ms, int>> entries = {
+        { a, 4 }, { b, 1 }, { a, 2 }, { a, 7 }, { b, 0 }
+    };
+    grid.assign( entries, std::less<>() );
+
+    CHECK( grid.at( a ).to_vector() == std::vector<int> { 2, 4, 7 } );
+    CHECK( grid.at( b ).to_vector() == std::vector<int> { 0, 1 } );
+    CHECK( grid.at( point_rel_ms( 1, 1 ) ).empty() );
+    CHECK_FALSE( grid.has_parts( point_rel_ms( 100, -100 ) ) );
+    CHECK( grid.mounts() == std::vector<point_rel_ms> { b, a } );
+}
+
+TEST_CASE( "vehicle_part_grid_appends_outside_of_bounds", "[vehicle][nogame]" )
+{
+    vehicle_part_grid grid;
+    grid.assign( { { point_rel_ms( 0, 0 ), 0 }, { point_rel_ms( 1, 0 ), 1 } }, std::less<>() );
+
+    // Appending to a mount that is not the last one in the array relocates it.
+    grid.push_back( point_rel_ms( 0, 0 ), 5 );
+    grid.push_back( point_rel_ms( 5, -4 ), 6 );
+    grid.push_back( point_rel_ms( 1, 0 ), 7 );
+
+    CHECK( grid.at( point_rel_ms( 0, 0 ) ).to_vector() == std::vector<int> { 0, 5 } );
+    CHECK( grid.at( point_rel_ms( 1, 0 ) ).to_vector() == std::vector<int> { 1, 7 } );
+    CHECK( grid.at( point_rel_ms( 5, -4 ) ).to_vector() == std::vector<int> { 6 } );
+    CHECK( grid.mounts().size() == 3 );
+
+    grid.clear();
+    CHECK( grid.empty() );
+    CHECK_FALSE( grid.has_parts( point_rel_ms( 0, 0 ) ) );
+}
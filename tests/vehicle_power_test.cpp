@@ -16,6 +16,7 @@
 #include "point.h"
 #include "type_id.h"
 #include "units.h"
+#include "veh_type.h"
 #include "vehicle.h"
 #include "vpart_position.h"
 #include "weather_type.h"
@@ -138,6 +139,14 @@ TEST_CASE( "power_loss_to_cables", "[vehicle][power]" )
         const int deficit = v.discharge_battery( here, preset.discharge );
         CHECK( deficit >= preset.min_discharge_deficit );
     }
+
+    // The connections are cached, unplugging a cord must still split the grid.
+    CHECK( v.get_power_grid( here ).members.size() == 3 );
+    const int cord_idx = v.part_with_feature( point_rel_ms::zero, VPFLAG_POWER_TRANSFER, false );
+    REQUIRE( cord_idx != -1 );
+    v.remove_part( v.part( cord_idx ) );
+    CHECK( v.get_power_grid( here ).members.size() == 1 );
+    CHECK( v.get_power_grid( here ).batteries.size() == 1 );
 }
 
 TEST_CASE( "Solar_power", "[vehicle][power]" )